@@ -0,0 +1,112 @@
+#include <chrono>   // steady_clock
+#include <cstdlib>  // atoi()
+#include <iostream> // cout
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../include/concurrent_list.hpp"
+#include "../include/list.hpp"
+
+// Throughput of sc::concurrent_list against a mutex around a sorted sc::list, for a growing number of threads.
+//
+// Usage: run_bench_concurrent [max_threads]
+// Prints "implementation,threads,mops_per_s" rows. Every thread runs the same mix of 80% contains,
+// 10% insert and 10% erase over 1024 keys, half of them present at the start.
+
+/// The setup we want to replace: one mutex around a sorted sc::list.
+class locked_list
+{
+public:
+    bool insert(int key)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = lower_bound(key);
+        if (it != seq.end() && *it == key)
+            return false;
+        seq.insert(it, key);
+        return true;
+    }
+
+    bool erase(int key)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = lower_bound(key);
+        if (it == seq.end() || *it != key)
+            return false;
+        seq.erase(it);
+        return true;
+    }
+
+    bool contains(int key)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = lower_bound(key);
+        return it != seq.end() && *it == key;
+    }
+
+private:
+    sc::list<int>::iterator lower_bound(int key)
+    {
+        auto it = seq.begin();
+        while (it != seq.end() && *it < key)
+            ++it;
+        return it;
+    }
+
+    std::mutex mtx;
+    sc::list<int> seq;
+};
+
+template <typename Set>
+double run(int threads, int ops_per_thread)
+{
+    const int keys = 1024;
+    Set set;
+    for (auto k{0}; k < keys; k += 2)
+        set.insert(k);
+
+    std::vector<std::thread> pool;
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (auto t{0}; t < threads; ++t)
+    {
+        pool.emplace_back([&set, t, ops_per_thread] {
+            std::mt19937 gen(t);
+            for (auto i{0}; i < ops_per_thread; ++i)
+            {
+                int key = gen() % keys;
+                int op = gen() % 10;
+                if (op == 0)
+                    set.insert(key);
+                else if (op == 1)
+                    set.erase(key);
+                else
+                    set.contains(key);
+            }
+        });
+    }
+
+    for (auto &th : pool)
+        th.join();
+
+    auto t1 = std::chrono::steady_clock::now();
+    return double(threads) * ops_per_thread / std::chrono::duration<double, std::micro>(t1 - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+    const int hw = static_cast<int>(std::thread::hardware_concurrency());
+    const int max_threads = argc > 1 ? std::atoi(argv[1]) : (hw > 0 ? hw : 8);
+    const int ops = 200000;
+
+    std::cout << "implementation,threads,mops_per_s\n";
+
+    for (auto threads{1}; threads <= max_threads; threads *= 2)
+    {
+        std::cout << "sc::concurrent_list," << threads << ',' << run<sc::concurrent_list<int>>(threads, ops) << '\n';
+        std::cout << "mutex+sc::list," << threads << ',' << run<locked_list>(threads, ops) << '\n';
+    }
+
+    return 0;
+}
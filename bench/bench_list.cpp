@@ -0,0 +1,220 @@
+#include <algorithm> // min()
+#include <array>
+#include <chrono>    // steady_clock
+#include <cstdlib>   // atol()
+#include <deque>
+#include <fstream>   // ofstream
+#include <iostream>  // cout, cerr
+#include <limits>
+#include <list>
+#include <utility>   // pair
+#include <string>
+#include <vector>
+#include "../include/compact_list.hpp"
+#include "../include/list.hpp"
+
+// Microbenchmarks of every sc::list operation, with std::list, std::deque and std::vector as baselines.
+//
+// Usage: run_bench [output.csv] [max_length]
+// Each row of the CSV is "container,element_bytes,length,operation,ns_per_op", the best of
+// three runs. Operations a baseline cannot do in a comparable way are skipped.
+
+/// Element of N bytes, compared and summed through its first byte.
+template <std::size_t N>
+struct payload
+{
+    std::array<unsigned char, N> bytes;
+
+    payload(int v = 0) { bytes.fill(static_cast<unsigned char>(v)); }
+
+    bool operator==(const payload &rhs) const { return bytes == rhs.bytes; }
+    bool operator!=(const payload &rhs) const { return bytes != rhs.bytes; }
+};
+
+template <typename C>
+struct traits;
+
+template <typename T>
+struct traits<sc::list<T>>
+{
+    static constexpr const char *name = "sc::list";
+    static constexpr bool has_front = true;
+    static constexpr bool cheap_middle = true;
+};
+
+template <typename T>
+struct traits<sc::compact_list<T>>
+{
+    static constexpr const char *name = "sc::compact_list";
+    static constexpr bool has_front = true;
+    static constexpr bool cheap_middle = true;
+};
+
+template <typename T>
+struct traits<std::list<T>>
+{
+    static constexpr const char *name = "std::list";
+    static constexpr bool has_front = true;
+    static constexpr bool cheap_middle = true;
+};
+
+template <typename T>
+struct traits<std::deque<T>>
+{
+    static constexpr const char *name = "std::deque";
+    static constexpr bool has_front = true;
+    static constexpr bool cheap_middle = false;
+};
+
+template <typename T>
+struct traits<std::vector<T>>
+{
+    static constexpr const char *name = "std::vector";
+    static constexpr bool has_front = false;
+    static constexpr bool cheap_middle = false;
+};
+
+/// Keeps results alive so the optimizer cannot drop the measured work.
+volatile unsigned long sink;
+
+/// Returns the best ns/op of three runs of run(setup()). Setting up and tearing down the state is not timed.
+template <typename Setup, typename Run>
+double measure(size_type ops, Setup setup, Run run)
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (int rep = 0; rep < 3; rep++)
+    {
+        auto state = setup();
+        auto t0 = std::chrono::steady_clock::now();
+        run(state);
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / ops);
+    }
+
+    return best;
+}
+
+/// Returns an iterator to the n-th element, walking one element at a time.
+template <typename C>
+typename C::iterator walk(C &c, size_type n)
+{
+    auto it = c.begin();
+    for (size_type i = 0; i < n; i++)
+        ++it;
+    return it;
+}
+
+template <typename C, typename T>
+void bench(std::ostream &out, std::size_t element_bytes, size_type length)
+{
+    using tr = traits<C>;
+
+    std::vector<T> source;
+    for (size_type i = 0; i < length; i++)
+        source.emplace_back(static_cast<int>(i));
+
+    auto row = [&](const char *operation, double ns) {
+        out << tr::name << ',' << element_bytes << ',' << length << ',' << operation << ',' << ns << '\n';
+    };
+    auto empty = [] { return C(); };
+    auto filled = [&] { return C(source.begin(), source.end()); };
+    auto two = [&] { return std::make_pair(C(source.begin(), source.end()), C()); };
+
+    row("construct_range", measure(length, empty, [&](C &c) {
+            c = C(source.begin(), source.end());
+        }));
+
+    row("push_back", measure(length, empty, [&](C &c) {
+            for (const auto &e : source)
+                c.push_back(e);
+        }));
+
+    row("pop_back", measure(length, filled, [&](C &c) {
+            for (size_type i = 0; i < length; i++)
+                c.pop_back();
+        }));
+
+    if constexpr (tr::has_front)
+    {
+        row("push_front", measure(length, empty, [&](C &c) {
+                for (const auto &e : source)
+                    c.push_front(e);
+            }));
+
+        row("pop_front", measure(length, filled, [&](C &c) {
+                for (size_type i = 0; i < length; i++)
+                    c.pop_front();
+            }));
+    }
+
+    // Containers that shift elements on a middle insertion get fewer operations.
+    const size_type middle_ops = tr::cheap_middle ? length : std::min<size_type>(length, 200);
+    const T value(7);
+
+    row("insert_middle", measure(middle_ops, filled, [&](C &c) {
+            auto it = walk(c, length / 2);
+            for (size_type i = 0; i < middle_ops; i++)
+                it = c.insert(it, value);
+        }));
+
+    row("erase_middle", measure(middle_ops, filled, [&](C &c) {
+            auto it = walk(c, (length - middle_ops) / 2);
+            for (size_type i = 0; i < middle_ops; i++)
+                it = c.erase(it);
+        }));
+
+    row("copy", measure(length, two, [&](std::pair<C, C> &s) {
+            s.second = C(s.first);
+        }));
+
+    auto copies = [&] { return std::make_pair(C(source.begin(), source.end()), C(source.begin(), source.end())); };
+    row("equal", measure(length, copies, [&](std::pair<C, C> &s) {
+            sink = sink + (s.first == s.second);
+        }));
+
+    row("iterate", measure(length, filled, [&](C &c) {
+            unsigned long sum = 0;
+            for (const auto &e : c)
+                sum += e.bytes[0];
+            sink = sink + sum;
+        }));
+}
+
+template <std::size_t N>
+void bench_all(std::ostream &out, size_type length)
+{
+    using T = payload<N>;
+
+    bench<sc::list<T>, T>(out, N, length);
+    bench<sc::compact_list<T>, T>(out, N, length);
+    bench<std::list<T>, T>(out, N, length);
+    bench<std::deque<T>, T>(out, N, length);
+    bench<std::vector<T>, T>(out, N, length);
+}
+
+int main(int argc, char *argv[])
+{
+    const std::string path = argc > 1 ? argv[1] : "bench_output.csv";
+    const size_type max_length = argc > 2 ? std::atol(argv[2]) : 100000;
+
+    std::ofstream out(path);
+    if (!out)
+    {
+        std::cerr << "Could not open " << path << '\n';
+        return 1;
+    }
+
+    out << "container,element_bytes,length,operation,ns_per_op\n";
+
+    for (size_type length = 1000; length <= max_length; length *= 10)
+    {
+        std::cerr << ">>> length " << length << '\n';
+        bench_all<8>(out, length);
+        bench_all<64>(out, length);
+        bench_all<256>(out, length);
+    }
+
+    std::cerr << ">>> Results written to " << path << '\n';
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <chrono>   // steady_clock
+#include <cstdlib>  // atoi()
+#include <iostream> // cout
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../include/list.hpp"
+#include "../include/lru_cache.hpp"
+
+// Throughput of sc::lru_cache against a global mutex around an sc::list and a hash map, for a growing number of threads.
+//
+// Usage: run_bench_lru [max_threads]
+// Prints "implementation,threads,mops_per_s" rows. Every thread looks up keys drawn from 64K with a
+// skewed distribution and puts the ones it misses, on a cache that holds a quarter of them.
+
+/// The setup we want to replace: one mutex around a recency list and a map from key to its node.
+class locked_lru
+{
+public:
+    explicit locked_lru(size_type capacity) : capacity{capacity} {}
+
+    bool get(int key, int &out)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto found = where.find(key);
+        if (found == where.end())
+            return false;
+
+        out = (*found->second).second;
+        recency.splice(recency.begin(), recency, found->second);
+        return true;
+    }
+
+    void put(int key, int value)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto found = where.find(key);
+        if (found != where.end())
+        {
+            (*found->second).second = value;
+            recency.splice(recency.begin(), recency, found->second);
+            return;
+        }
+
+        recency.push_front({key, value});
+        where[key] = recency.begin();
+        if (recency.size() > capacity)
+        {
+            where.erase(recency.back().first);
+            recency.pop_back();
+        }
+    }
+
+private:
+    std::mutex mtx;
+    size_type capacity;
+    sc::list<std::pair<int, int>> recency;
+    std::unordered_map<int, sc::list<std::pair<int, int>>::iterator> where;
+};
+
+template <typename Cache>
+double run(int threads, int ops_per_thread)
+{
+    const int keys = 1 << 16;
+    Cache cache(keys / 4);
+
+    std::vector<std::thread> pool;
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (auto t{0}; t < threads; ++t)
+    {
+        pool.emplace_back([&cache, t, ops_per_thread] {
+            std::mt19937 gen(t);
+            std::geometric_distribution<int> skew(1.0 / 4096);
+            for (auto i{0}; i < ops_per_thread; ++i)
+            {
+                int key = skew(gen) % keys;
+                int value;
+                if (!cache.get(key, value))
+                    cache.put(key, key);
+            }
+        });
+    }
+
+    for (auto &th : pool)
+        th.join();
+
+    auto t1 = std::chrono::steady_clock::now();
+    return double(threads) * ops_per_thread / std::chrono::duration<double, std::micro>(t1 - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+    const int hw = static_cast<int>(std::thread::hardware_concurrency());
+    const int max_threads = argc > 1 ? std::atoi(argv[1]) : (hw > 0 ? hw : 8);
+    const int ops = 500000;
+
+    std::cout << "implementation,threads,mops_per_s\n";
+
+    for (auto threads{1}; threads <= max_threads; threads *= 2)
+    {
+        std::cout << "sc::lru_cache," << threads << ',' << run<sc::lru_cache<int, int>>(threads, ops) << '\n';
+        std::cout << "mutex+sc::list," << threads << ',' << run<locked_lru>(threads, ops) << '\n';
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include <algorithm> // find(), count(), equal(), lexicographical_compare(), shuffle()
+#include <chrono>    // steady_clock
+#include <cstdlib>   // atol()
+#include <iostream>  // cout, cerr
+#include <limits>
+#include <random>
+#include <vector>
+#include "../include/list.hpp"
+
+// The traversal kernels of sc::list against the loops they replaced, which follow one link at a time.
+//
+// Usage: run_bench_traversal [length]
+// Prints "layout,length,operation,implementation,ns_per_node" rows, the best of three runs. The
+// default length of 8M nodes puts each list well past the last level cache of most machines.
+// Layouts: "sequential" lists were built by one range constructor, so their nodes follow each
+// other in memory; "scattered" lists were sorted afterwards, so consecutive nodes are far apart.
+
+/// Keeps results alive so the optimizer cannot drop the measured work.
+volatile unsigned long sink;
+
+/// Returns the best ns per node of three runs of run().
+template <typename Run>
+double measure(size_type nodes, Run run)
+{
+    double best = std::numeric_limits<double>::max();
+
+    for (int rep = 0; rep < 3; rep++)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / nodes);
+    }
+
+    return best;
+}
+
+/// Returns a list holding 0 .. length-1 in order, with its nodes in the given layout.
+sc::list<int> build(size_type length, bool scattered)
+{
+    std::vector<int> values(length);
+    for (size_type i = 0; i < length; i++)
+        values[i] = static_cast<int>(i);
+
+    if (!scattered)
+        return sc::list<int>(values.begin(), values.end());
+
+    // Nodes are laid out in the shuffled order; sorting relinks them without moving them.
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+    sc::list<int> seq(values.begin(), values.end());
+    seq.sort();
+    return seq;
+}
+
+void bench(size_type length, bool scattered)
+{
+    const char *layout = scattered ? "scattered" : "sequential";
+    auto row = [&](const char *operation, const char *implementation, double ns) {
+        std::cout << layout << ',' << length << ',' << operation << ',' << implementation << ',' << ns << '\n';
+    };
+
+    sc::list<int> a = build(length, scattered);
+    sc::list<int> b = build(length, scattered);
+    const int last = static_cast<int>(length) - 1; // Found only at the very end
+    const sc::list<int> &ca = a;
+    const sc::list<int> &cb = b;
+
+    row("find", "loop", measure(length, [&] { sink = sink + *std::find(ca.begin(), ca.end(), last); }));
+    row("find", "kernel", measure(length, [&] { sink = sink + *ca.find(last); }));
+
+    row("count", "loop", measure(length, [&] { sink = sink + std::count(ca.begin(), ca.end(), last); }));
+    row("count", "kernel", measure(length, [&] { sink = sink + ca.count(last); }));
+
+    // Both lists are walked, so the time is per pair of nodes.
+    row("equal", "loop", measure(length, [&] { sink = sink + std::equal(ca.begin(), ca.end(), cb.begin(), cb.end()); }));
+    row("equal", "kernel", measure(length, [&] { sink = sink + (ca == cb); }));
+
+    row("lexicographical_compare", "loop", measure(length, [&] {
+            sink = sink + std::lexicographical_compare(ca.begin(), ca.end(), cb.begin(), cb.end());
+        }));
+    row("lexicographical_compare", "kernel", measure(length, [&] { sink = sink + (ca < cb); }));
+
+    row("assign", "loop", measure(length, [&] {
+            for (auto &e : a)
+                e = 1;
+        }));
+    row("assign", "kernel", measure(length, [&] { a.assign(1); }));
+}
+
+int main(int argc, char *argv[])
+{
+    const size_type length = argc > 1 ? std::atol(argv[1]) : size_type(1) << 23;
+
+    std::cout << "layout,length,operation,implementation,ns_per_node\n";
+    std::cerr << ">>> sequential layout\n";
+    bench(length, false);
+    std::cerr << ">>> scattered layout\n";
+    bench(length, true);
+
+    return 0;
+}
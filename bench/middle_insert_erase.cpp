@@ -0,0 +1,41 @@
+#include <chrono>   // steady_clock
+#include <cstdlib>  // atol()
+#include <iostream> // cout, endl
+#include "../include/list.hpp"
+
+// Regression benchmark: insert/erase in the middle of lists of growing length.
+// Both operations receive an iterator, so the cost per operation must not grow with the list.
+int main(int argc, char *argv[])
+{
+    const size_type max_len = argc > 1 ? std::atol(argv[1]) : 10000000;
+    const size_type ops = 1000000;
+
+    std::cout << "length,insert_ns_per_op,erase_ns_per_op\n";
+
+    for (size_type len = 1000; len <= max_len; len *= 10)
+    {
+        sc::list<int> seq;
+        for (size_type i = 0; i < len; i++)
+            seq.push_back(static_cast<int>(i));
+
+        // Walking to the middle is paid once, outside the timed region.
+        auto mid = seq.begin() + static_cast<int>(len / 2);
+
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_type i = 0; i < ops; i++)
+            mid = seq.insert(mid, static_cast<int>(i));
+        auto t1 = std::chrono::steady_clock::now();
+        for (size_type i = 0; i < ops; i++)
+            mid = seq.erase(mid);
+        auto t2 = std::chrono::steady_clock::now();
+
+        if (seq.size() != len)
+            return 1;
+
+        std::cout << len << ','
+                  << std::chrono::duration<double, std::nano>(t1 - t0).count() / ops << ','
+                  << std::chrono::duration<double, std::nano>(t2 - t1).count() / ops << '\n';
+    }
+
+    return 0;
+}
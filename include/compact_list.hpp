@@ -0,0 +1,754 @@
+#ifndef COMPACT_LIST_H
+#define COMPACT_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Doubly linked list whose nodes live in one growable array and link to each other by index.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Slot 0 of the array is the sentinel and the other slots are either nodes of the list or in a
+     * free list threaded through their next field. With the default 32-bit Index, each element costs
+     * two 4-byte links instead of two pointers plus a heap block of its own, and nodes created one
+     * after the other sit next to each other in memory.
+     *
+     * When the array is full it grows to twice its size and the elements are moved to the new one.
+     * Iterators hold an index, so they stay valid across that relocation (references do not).
+     * Nothing is allocated until the first element is inserted.
+     */
+    template <typename T, typename Alloc = std::allocator<T>, typename Index = std::uint32_t>
+    class compact_list
+    {
+    private:
+        /// A node: links to the previous and next slots and the data.
+        struct Slot
+        {
+            Index prev;                                  //<! Index of the previous node in the list
+            Index next;                                  //<! Index of the next node in the list, or of the next free slot
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+        };
+
+        using slot_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+        using slot_traits = std::allocator_traits<slot_allocator>;
+
+        static constexpr Index null = 0; //<! Index of the sentinel, also ends the free list
+
+    public:
+        /**
+         * @brief Constant iterator of a compact list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates the list and the index of a slot.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : owner{nullptr}, index{null} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return owner->slots[index].data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                index = owner->slots[index].next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                index = owner->slots[index].prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return index == rhs.index && owner == rhs.owner;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+        protected:
+            const compact_list *owner; //<! The list, whose array may be relocated.
+            Index index;               //<! Slot of the element.
+            const_iterator(const compact_list *o, Index i) : owner(o), index(i) {}
+            friend class compact_list;
+        };
+
+        /**
+         * @brief Iterator of a compact list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates the list and the index of a slot.
+         */
+        class iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            iterator() : owner{nullptr}, index{null} {}
+
+            /// Return a const reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return owner->slots[index].data(); }
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() { return owner->slots[index].data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                index = owner->slots[index].next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator and returns it.
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            friend iterator operator+(iterator it, int n)
+            {
+                for (int i = 0; i < n; i++)
+                    ++it;
+
+                return it;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator &operator--()
+            {
+                index = owner->slots[index].prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns the distance between the elements (not between the adresses).
+            size_type operator-(iterator rhs) const
+            {
+                size_type dis = 0;
+
+                for (; rhs.index != index; ++rhs)
+                    dis++;
+
+                return dis;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return index == rhs.index && owner == rhs.owner;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(owner, index); }
+
+        protected:
+            compact_list *owner; //<! The list, whose array may be relocated.
+            Index index;         //<! Slot of the element.
+            iterator(compact_list *o, Index i) : owner(o), index(i) {}
+            friend class compact_list;
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        compact_list() : compact_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its array from alloc.
+        explicit compact_list(const Alloc &a) : SIZE{0}, slots{nullptr}, cap{0}, used{0}, free_head{null}, alloc{a} {}
+
+        /// Constructs the list with count default-inserted instances of T.
+        explicit compact_list(size_type count, const Alloc &a = Alloc()) : compact_list(a)
+        {
+            reserve(count);
+            for (size_type i = 0; i < count; i++)
+                emplace_back();
+        }
+
+        /// Constructs the list with the contents of the range [first, last).
+        template <typename InputIt>
+        compact_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : compact_list(a)
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+
+        /// Constructs the list with the contents of the initializer list init.
+        compact_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : compact_list(a)
+        {
+            reserve(ilist.size());
+            for (const T &value : ilist)
+                emplace_back(value);
+        }
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other, in list order.
+        compact_list(const compact_list &other)
+            : compact_list(Alloc(slot_traits::select_on_container_copy_construction(other.alloc)))
+        {
+            reserve(other.SIZE);
+            for (const auto &value : other)
+                emplace_back(value);
+        }
+
+        /// Move constructor. Takes over the array of other in O(1), leaving other empty.
+        compact_list(compact_list &&other) noexcept : compact_list(Alloc(other.alloc))
+        {
+            take_slots(other);
+        }
+
+        /// Destructor
+        ~compact_list()
+        {
+            clear();
+            release();
+        }
+
+        /// Copy the size and values from another list.
+        compact_list &operator=(const compact_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                reserve(other.SIZE);
+                for (const auto &value : other)
+                    emplace_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the array of other, leaving it empty.
+        compact_list &operator=(compact_list &&other) noexcept(slot_traits::propagate_on_container_move_assignment::value || slot_traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            if (slot_traits::propagate_on_container_move_assignment::value)
+            {
+                release();
+                alloc = other.alloc;
+                take_slots(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                release();
+                take_slots(other);
+            }
+            else
+            {
+                reserve(other.SIZE);
+                for (auto &value : other)
+                    emplace_back(std::move(value));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        /// Replaces the contents with those identified by initializer list ilist.
+        compact_list &operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            reserve(ilist.size());
+            for (const T &value : ilist)
+                emplace_back(value);
+
+            return *this;
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(this, slots != nullptr ? slots[null].next : null);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(this, null);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(this, slots != nullptr ? slots[null].next : null);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(this, null);
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        /// Largest number of elements that Index can address.
+        static constexpr size_type max_size()
+        {
+            return size_type(std::numeric_limits<Index>::max()) - 1;
+        }
+
+        /// Number of elements that fit without growing the array.
+        size_type capacity() const
+        {
+            return cap > 0 ? cap - 1 : 0;
+        }
+
+        /// Grows the array, if needed, so that count elements fit without relocating.
+        void reserve(size_type count)
+        {
+            if (count > max_size())
+                throw std::length_error("sc::compact_list::reserve");
+
+            if (count > capacity())
+                relocate(count + 1);
+        }
+
+        // [IV] MODIFIERS
+
+        /// Remove all elements from the container. The array is kept.
+        void clear()
+        {
+            if (slots == nullptr)
+                return;
+
+            for (Index i = slots[null].next; i != null;)
+            {
+                Index nxt = slots[i].next;
+                slot_traits::destroy(alloc, slots[i].data_ptr());
+                i = nxt;
+            }
+
+            slots[null].prev = slots[null].next = null;
+            used = 1;
+            free_head = null;
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return *begin();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return *cbegin();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return slots[slots[null].prev].data();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return slots[slots[null].prev].data();
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            emplace_front(value);
+        }
+
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace_front(std::move(value));
+        }
+
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            emplace_back(value);
+        }
+
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase(iterator(this, slots[null].prev));
+        }
+
+        /// Adds value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, const T &value)
+        {
+            return emplace(pos, value);
+        }
+
+        /// Moves value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            if (first == last)
+                return pos;
+
+            iterator firstInserted = emplace(pos, *first);
+            for (++first; first != last; ++first)
+                emplace(pos, *first);
+
+            return firstInserted;
+        }
+
+        /// Inserts elements from the initializer list ilist before pos and returns an iterator to the first inserted item.
+        iterator insert(iterator pos, std::initializer_list<T> ilist)
+        {
+            reserve(SIZE + ilist.size());
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Constructs an element in place before pos and returns an iterator to it. May relocate the array.
+        template <typename... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            Index i = create_slot(std::forward<Args>(args)...);
+
+            Index p = pos.index;
+            slots[i].prev = slots[p].prev;
+            slots[i].next = p;
+            slots[slots[p].prev].next = i;
+            slots[p].prev = i;
+            SIZE++;
+
+            return iterator(this, i);
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos)
+        {
+            Index i = pos.index;
+            Index nxt = slots[i].next;
+
+            slots[slots[i].prev].next = nxt;
+            slots[nxt].prev = slots[i].prev;
+            slot_traits::destroy(alloc, slots[i].data_ptr());
+            give_slot(i);
+            SIZE--;
+
+            return iterator(this, nxt);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+
+            return last;
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const compact_list &lhs, const compact_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (*l != *r)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const compact_list &lhs, const compact_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// Constructs a T from args in a free slot and returns its index, growing the array if every slot is taken.
+        template <typename... Args>
+        Index create_slot(Args &&...args)
+        {
+            if (free_head != null)
+            {
+                Index i = free_head;
+                slot_traits::construct(alloc, slots[i].data_ptr(), std::forward<Args>(args)...);
+                free_head = slots[i].next;
+                return i;
+            }
+
+            if (used < cap)
+            {
+                slot_traits::construct(alloc, slots[used].data_ptr(), std::forward<Args>(args)...);
+                return used++;
+            }
+
+            if (SIZE >= max_size())
+                throw std::length_error("sc::compact_list");
+
+            size_type n = cap < 8 ? 16 : 2 * size_type(cap);
+            if (n > max_size() + 1)
+                n = max_size() + 1;
+
+            // The new element is built before the old ones move, as args may refer to one of them.
+            Slot *grown = slot_traits::allocate(alloc, n);
+            Index i = slots != nullptr ? used : 1;
+
+            try
+            {
+                slot_traits::construct(alloc, grown[i].data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                slot_traits::deallocate(alloc, grown, n);
+                throw;
+            }
+
+            try
+            {
+                move_to(grown);
+            }
+            catch (...)
+            {
+                slot_traits::destroy(alloc, grown[i].data_ptr());
+                slot_traits::deallocate(alloc, grown, n);
+                throw;
+            }
+
+            adopt(grown, n);
+            return used++;
+        }
+
+        /// Puts slot i, which holds no data, at the top of the free list.
+        void give_slot(Index i)
+        {
+            slots[i].next = free_head;
+            free_head = i;
+        }
+
+        /// Moves the list to a new array of n slots. The slot indices do not change.
+        void relocate(size_type n)
+        {
+            Slot *grown = slot_traits::allocate(alloc, n);
+
+            try
+            {
+                move_to(grown);
+            }
+            catch (...)
+            {
+                slot_traits::deallocate(alloc, grown, n);
+                throw;
+            }
+
+            adopt(grown, n);
+        }
+
+        /// Copies the links and moves the elements to the same slots of grown. On failure the list is unchanged.
+        void move_to(Slot *grown)
+        {
+            if (slots == nullptr)
+            {
+                grown[null].prev = grown[null].next = null;
+                return;
+            }
+
+            for (Index k = 0; k < used; k++)
+            {
+                grown[k].prev = slots[k].prev;
+                grown[k].next = slots[k].next;
+            }
+
+            Index i = slots[null].next;
+
+            try
+            {
+                for (; i != null; i = slots[i].next)
+                    slot_traits::construct(alloc, grown[i].data_ptr(), std::move_if_noexcept(slots[i].data()));
+            }
+            catch (...)
+            {
+                for (Index k = slots[null].next; k != i; k = slots[k].next)
+                    slot_traits::destroy(alloc, grown[k].data_ptr());
+                throw;
+            }
+        }
+
+        /// Destroys the elements of the current array, frees it and makes grown, of n slots, the array.
+        void adopt(Slot *grown, size_type n)
+        {
+            if (slots != nullptr)
+            {
+                for (Index i = slots[null].next; i != null; i = slots[i].next)
+                    slot_traits::destroy(alloc, slots[i].data_ptr());
+                slot_traits::deallocate(alloc, slots, cap);
+            }
+            else
+            {
+                used = 1;
+            }
+
+            slots = grown;
+            cap = Index(n);
+        }
+
+        /// Gives the array back to the allocator. The list must be empty.
+        void release()
+        {
+            if (slots != nullptr)
+                slot_traits::deallocate(alloc, slots, cap);
+
+            slots = nullptr;
+            cap = used = 0;
+            free_head = null;
+        }
+
+        /// Moves the array of other to this list, which must have none, and leaves other empty.
+        void take_slots(compact_list &other)
+        {
+            SIZE = other.SIZE;
+            slots = other.slots;
+            cap = other.cap;
+            used = other.used;
+            free_head = other.free_head;
+
+            other.SIZE = 0;
+            other.slots = nullptr;
+            other.cap = other.used = 0;
+            other.free_head = null;
+        }
+
+        size_type SIZE;
+        Slot *slots;     //<! The array, slot 0 is the sentinel
+        Index cap;       //<! Slots in the array
+        Index used;      //<! Slots [0, used) have been handed out at some point
+        Index free_head; //<! First slot of the free list
+        slot_allocator alloc;
+    };
+} // namespace sc
+
+#endif
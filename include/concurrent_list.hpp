@@ -0,0 +1,241 @@
+#ifndef CONCURRENT_LIST_H
+#define CONCURRENT_LIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "epoch.hpp"
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Lock-free sorted set implemented as a Harris linked list.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Nodes follow the same concept as the ones of sc::list (a data field plus links), but only the
+     * next link is kept and it is atomic. Its lowest bit marks the node as logically deleted:
+     * erase() first marks the node and then tries to unlink it, and any traversal that finds a
+     * marked node helps unlinking it. Unlinked nodes are retired to an epoch_domain, so they are
+     * only freed when no thread can still be reading them.
+     *
+     * insert(), erase() and contains() may be called from any number of threads. Construction,
+     * destruction and clear() must not run concurrently with anything else.
+     */
+    template <typename T, typename Compare = std::less<T>>
+    class concurrent_list
+    {
+    private:
+        /// Representation of a node, it contains a data and a marked reference to the next node.
+        struct Node
+        {
+            T data;                          //<! Data field
+            std::atomic<std::uintptr_t> next; //<! Pointer to the next node, the lowest bit is the deletion mark
+
+            template <typename... Args>
+            explicit Node(Args &&...args) : data(std::forward<Args>(args)...), next{0} {}
+        };
+
+    public:
+        /// Default constructor that creates an empty list.
+        explicit concurrent_list(Compare c = Compare()) : comp{c}, head{0}, SIZE{0} {}
+
+        concurrent_list(const concurrent_list &) = delete;
+        concurrent_list &operator=(const concurrent_list &) = delete;
+
+        /// Destructor
+        ~concurrent_list()
+        {
+            clear();
+        }
+
+        /// Inserts value keeping the list sorted. Returns false if an equivalent value was already there.
+        bool insert(const T &value)
+        {
+            return emplace(value);
+        }
+
+        /// Moves value into the list. Returns false if an equivalent value was already there.
+        bool insert(T &&value)
+        {
+            return emplace(std::move(value));
+        }
+
+        /// Constructs a value in place and inserts it. Returns false if an equivalent value was already there.
+        template <typename... Args>
+        bool emplace(Args &&...args)
+        {
+            Node *newNode = new Node(std::forward<Args>(args)...);
+            epoch_domain::guard g(domain);
+
+            for (;;)
+            {
+                std::atomic<std::uintptr_t> *prev;
+                Node *cur = search(newNode->data, prev, g);
+
+                if (cur != nullptr && !comp(newNode->data, cur->data))
+                {
+                    delete newNode;
+                    return false;
+                }
+
+                std::uintptr_t expected = to_link(cur);
+                newNode->next.store(expected, std::memory_order_relaxed);
+
+                if (prev->compare_exchange_strong(expected, to_link(newNode)))
+                {
+                    SIZE.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+
+        /// Removes the value equivalent to key. Returns false if there was none.
+        bool erase(const T &key)
+        {
+            epoch_domain::guard g(domain);
+
+            for (;;)
+            {
+                std::atomic<std::uintptr_t> *prev;
+                Node *cur = search(key, prev, g);
+
+                if (cur == nullptr || comp(key, cur->data))
+                    return false;
+
+                // Logical deletion: whoever marks the node owns the erase.
+                std::uintptr_t next = cur->next.load();
+                if (is_marked(next))
+                    continue;
+                if (!cur->next.compare_exchange_strong(next, next | 1))
+                    continue;
+
+                SIZE.fetch_sub(1, std::memory_order_relaxed);
+
+                // Physical deletion: on failure a later search unlinks it.
+                std::uintptr_t expected = to_link(cur);
+                if (prev->compare_exchange_strong(expected, next))
+                    g.retire(cur);
+                else
+                    search(key, prev, g);
+
+                return true;
+            }
+        }
+
+        /// Returns true if a value equivalent to key is in the list. Never writes to the nodes; pinning the domain writes to an epoch slot.
+        bool contains(const T &key) const
+        {
+            epoch_domain::guard g(domain);
+
+            Node *cur = to_node(head.load());
+            while (cur != nullptr && comp(cur->data, key))
+                cur = to_node(cur->next.load());
+
+            return cur != nullptr && !comp(key, cur->data) && !is_marked(cur->next.load());
+        }
+
+        /// Calls f on every value that is not being deleted, in order.
+        template <typename Function>
+        void for_each(Function f) const
+        {
+            epoch_domain::guard g(domain);
+
+            for (Node *cur = to_node(head.load()); cur != nullptr;)
+            {
+                std::uintptr_t next = cur->next.load();
+                if (!is_marked(next))
+                    f(static_cast<const T &>(cur->data));
+                cur = to_node(next);
+            }
+        }
+
+        /// Return the number of elements in the container. Only a snapshot while other threads are writing.
+        size_type size() const
+        {
+            return SIZE.load(std::memory_order_relaxed);
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        /// Remove all elements from the container. Not thread-safe.
+        void clear()
+        {
+            Node *cur = to_node(head.load());
+
+            while (cur != nullptr)
+            {
+                Node *nxt = to_node(cur->next.load());
+                delete cur;
+                cur = nxt;
+            }
+
+            head.store(0);
+            SIZE.store(0);
+        }
+
+    private:
+        static bool is_marked(std::uintptr_t link)
+        {
+            return (link & 1) != 0;
+        }
+
+        static Node *to_node(std::uintptr_t link)
+        {
+            return reinterpret_cast<Node *>(link & ~std::uintptr_t{1});
+        }
+
+        static std::uintptr_t to_link(Node *node)
+        {
+            return reinterpret_cast<std::uintptr_t>(node);
+        }
+
+        /**
+         * Finds the first node not less than key and the unmarked link that points to it, unlinking the
+         * marked nodes found on the way. Returns nullptr when every node is less than key.
+         */
+        Node *search(const T &key, std::atomic<std::uintptr_t> *&prev, epoch_domain::guard &g)
+        {
+        retry:
+            prev = &head;
+            Node *cur = to_node(prev->load());
+
+            while (cur != nullptr)
+            {
+                std::uintptr_t next = cur->next.load();
+
+                if (is_marked(next))
+                {
+                    std::uintptr_t expected = to_link(cur);
+                    if (!prev->compare_exchange_strong(expected, next & ~std::uintptr_t{1}))
+                        goto retry;
+
+                    g.retire(cur);
+                    cur = to_node(next);
+                    continue;
+                }
+
+                if (!comp(cur->data, key))
+                    return cur;
+
+                prev = &cur->next;
+                cur = to_node(next);
+            }
+
+            return nullptr;
+        }
+
+        Compare comp;
+        std::atomic<std::uintptr_t> head; //<! Link to the first node, never marked
+        std::atomic<size_type> SIZE;
+        mutable epoch_domain domain;
+    };
+} // namespace sc
+
+#endif
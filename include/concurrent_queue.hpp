@@ -0,0 +1,273 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Multi-producer multi-consumer FIFO queue with one lock per end (Michael & Scott two-lock queue).
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Nodes have the layout of the ones of sc::list: a link plus raw storage that only holds a
+     * constructed T while the element is queued. The front node is a dataless dummy, so producers
+     * only touch the tail and consumers only touch the head, and each end has its own mutex.
+     * A producer wakes blocked consumers only when some consumer is actually waiting.
+     */
+    template <typename T>
+    class concurrent_queue
+    {
+    private:
+        /// Representation of a node, it contains a data and a reference to the next node.
+        struct Node
+        {
+            std::atomic<Node *> next;                    //<! Pointer to the next node, written by producers and read by consumers
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field, constructed only while the node is queued
+
+            Node() : next{nullptr} {}
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+        };
+
+    public:
+        /// Default constructor that creates an empty queue.
+        concurrent_queue() : head{new Node}, tail{head.node}, SIZE{0}, waiters{0} {}
+
+        concurrent_queue(const concurrent_queue &) = delete;
+        concurrent_queue &operator=(const concurrent_queue &) = delete;
+
+        /// Destructor. No thread may be using the queue.
+        ~concurrent_queue()
+        {
+            Node *dummy = head.node;
+            destroy_chain(dummy->next.load());
+            delete dummy;
+        }
+
+        /// Adds value to the back of the queue.
+        void push_back(const T &value)
+        {
+            emplace_back(value);
+        }
+
+        /// Moves value to the back of the queue.
+        void push_back(T &&value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the queue.
+        template <typename... Args>
+        void emplace_back(Args &&...args)
+        {
+            Node *newNode = create_node(std::forward<Args>(args)...);
+            link(newNode, newNode, 1);
+        }
+
+        /// Adds the elements of [first, last) to the back of the queue with a single lock acquisition.
+        template <typename InputIt>
+        void push_bulk(InputIt first, InputIt last)
+        {
+            if (first == last)
+                return;
+
+            // The chain is built outside of the lock.
+            Node *chainFirst = create_node(*first);
+            Node *chainLast = chainFirst;
+            size_type count = 1;
+
+            try
+            {
+                for (++first; first != last; ++first, ++count)
+                {
+                    Node *newNode = create_node(*first);
+                    chainLast->next.store(newNode, std::memory_order_relaxed);
+                    chainLast = newNode;
+                }
+            }
+            catch (...)
+            {
+                destroy_chain(chainFirst);
+                throw;
+            }
+
+            link(chainFirst, chainLast, count);
+        }
+
+        /// Moves the front element into value and removes it. Returns false without waiting if the queue is empty.
+        bool try_pop(T &value)
+        {
+            std::lock_guard<std::mutex> lock(head.mtx);
+            return pop_locked(value);
+        }
+
+        /// Waits for an element, then moves it into value and removes it.
+        void pop_front(T &value)
+        {
+            std::unique_lock<std::mutex> lock(head.mtx);
+            waiters.fetch_add(1);
+            head.ready.wait(lock, [this] { return head.node->next.load() != nullptr; });
+            waiters.fetch_sub(1);
+            pop_locked(value);
+        }
+
+        /// Waits up to timeout for an element. Returns false if none arrived in time.
+        template <typename Rep, typename Period>
+        bool try_pop_for(T &value, const std::chrono::duration<Rep, Period> &timeout)
+        {
+            std::unique_lock<std::mutex> lock(head.mtx);
+            waiters.fetch_add(1);
+            bool ready = head.ready.wait_for(lock, timeout, [this] { return head.node->next.load() != nullptr; });
+            waiters.fetch_sub(1);
+
+            return ready && pop_locked(value);
+        }
+
+        /// Moves up to max elements to out with a single lock acquisition and returns how many were moved.
+        template <typename OutputIt>
+        size_type pop_bulk(OutputIt out, size_type max)
+        {
+            std::lock_guard<std::mutex> lock(head.mtx);
+            size_type popped = 0;
+
+            for (; popped < max; popped++)
+            {
+                Node *first = head.node->next.load();
+                if (first == nullptr)
+                    break;
+
+                *out = std::move(first->data());
+                ++out;
+                advance_head(first);
+            }
+
+            return popped;
+        }
+
+        /// Return the number of elements in the queue. Only a snapshot while other threads are using it.
+        size_type size() const
+        {
+            return SIZE.load(std::memory_order_relaxed);
+        }
+
+        /// Returns true if the queue contains no elements. Only a snapshot while other threads are using it.
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+    private:
+        template <typename... Args>
+        static Node *create_node(Args &&...args)
+        {
+            Node *newNode = new Node;
+
+            try
+            {
+                ::new (newNode->data_ptr()) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                delete newNode;
+                throw;
+            }
+
+            return newNode;
+        }
+
+        /// Destroys and frees a null-terminated chain of nodes holding data.
+        static void destroy_chain(Node *cur)
+        {
+            while (cur != nullptr)
+            {
+                Node *nxt = cur->next.load(std::memory_order_relaxed);
+                cur->data().~T();
+                delete cur;
+                cur = nxt;
+            }
+        }
+
+        /// Appends the chain [first, last] at the tail and wakes waiting consumers.
+        void link(Node *first, Node *last, size_type count)
+        {
+            // Counted before publishing so a consumer never decrements below zero.
+            SIZE.fetch_add(count);
+
+            {
+                std::lock_guard<std::mutex> lock(tail.mtx);
+                tail.node->next.store(first);
+                tail.node = last;
+            }
+
+            // Consumers register as waiters before checking for elements, so reading 0 here means
+            // any consumer that starts waiting later will see the new nodes.
+            if (waiters.load() > 0)
+            {
+                std::lock_guard<std::mutex> lock(head.mtx);
+                if (count == 1)
+                    head.ready.notify_one();
+                else
+                    head.ready.notify_all();
+            }
+        }
+
+        /// Pops the front element with the head lock held.
+        bool pop_locked(T &value)
+        {
+            Node *first = head.node->next.load();
+            if (first == nullptr)
+                return false;
+
+            value = std::move(first->data());
+            advance_head(first);
+            return true;
+        }
+
+        /// Makes first (whose data was just moved out) the new dummy and frees the old one.
+        void advance_head(Node *first)
+        {
+            first->data().~T();
+            Node *oldDummy = head.node;
+            head.node = first;
+            SIZE.fetch_sub(1, std::memory_order_relaxed);
+            delete oldDummy;
+        }
+
+        /// Consumer side, on its own cache line.
+        struct alignas(64) Head
+        {
+            std::mutex mtx;
+            std::condition_variable ready;
+            Node *node; //<! Dummy node, its next is the front element
+
+            explicit Head(Node *n) : node{n} {}
+        };
+
+        /// Producer side, on its own cache line.
+        struct alignas(64) Tail
+        {
+            std::mutex mtx;
+            Node *node; //<! Last node
+
+            explicit Tail(Node *n) : node{n} {}
+        };
+
+        Head head;
+        Tail tail;
+        std::atomic<size_type> SIZE;
+        std::atomic<size_type> waiters; //<! Consumers blocked in pop_front() or try_pop_for()
+    };
+} // namespace sc
+
+#endif
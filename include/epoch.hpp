@@ -0,0 +1,215 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace sc
+{
+    /**
+     * @brief Epoch-based memory reclamation for lock-free containers.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Threads pin the domain while they hold pointers into a shared structure. A node that has been
+     * unlinked is retired with the global epoch of that moment and freed once the global epoch is
+     * two steps ahead, which can only happen after every thread pinned at that time has unpinned.
+     *
+     * Pins are served from a fixed table of slots claimed per operation, so threads do not need to
+     * register, and the list of retired nodes of a slot is drained by whoever claims it next. When
+     * every slot of the table is owned (more than max_slots threads, or nested guards) the table
+     * grows with overflow slots, which are scanned one by one and kept until the domain is destroyed.
+     */
+    class epoch_domain
+    {
+    private:
+        static constexpr std::uint64_t idle = ~std::uint64_t{0};
+        static constexpr std::size_t collect_period = 64;
+
+        /// A node waiting to be freed and the epoch it was retired in.
+        struct Retired
+        {
+            void *ptr;
+            void (*deleter)(void *);
+            std::uint64_t epoch;
+        };
+
+        /// Pin slot, padded to its own cache line.
+        struct alignas(64) Slot
+        {
+            std::atomic<bool> owned{false};
+            std::atomic<std::uint64_t> epoch{idle};
+            std::vector<Retired> retired;
+            Slot *next = nullptr; //<! Next overflow slot, set before the slot is published
+        };
+
+    public:
+        static constexpr std::size_t max_slots = 128; //<! Operations that can be pinned at the same time without overflow slots.
+
+        epoch_domain() : global{0}, overflow{nullptr} {}
+
+        epoch_domain(const epoch_domain &) = delete;
+        epoch_domain &operator=(const epoch_domain &) = delete;
+
+        /// Destructor. No thread may be pinned, every retired node is freed.
+        ~epoch_domain()
+        {
+            for (auto &slot : slots)
+            {
+                for (auto &r : slot.retired)
+                    r.deleter(r.ptr);
+            }
+
+            for (Slot *slot = overflow.load(); slot != nullptr;)
+            {
+                for (auto &r : slot->retired)
+                    r.deleter(r.ptr);
+
+                Slot *nxt = slot->next;
+                delete slot;
+                slot = nxt;
+            }
+        }
+
+        /**
+         * @brief Scope during which the nodes reachable from a shared structure will not be freed.
+         *
+         * Retiring goes through the guard so the node lands in the retired list of the pinned slot.
+         */
+        class guard
+        {
+        public:
+            /// Pins the domain.
+            explicit guard(epoch_domain &d) : domain{d}, slot{d.claim()}
+            {
+                slot->epoch.store(domain.global.load());
+            }
+
+            guard(const guard &) = delete;
+            guard &operator=(const guard &) = delete;
+
+            /// Unpins the domain.
+            ~guard()
+            {
+                slot->epoch.store(idle, std::memory_order_release);
+                slot->owned.store(false, std::memory_order_release);
+            }
+
+            /// Hands an unlinked node to the domain, deleter(ptr) runs once no thread can still see it.
+            void retire(void *ptr, void (*deleter)(void *))
+            {
+                slot->retired.push_back(Retired{ptr, deleter, domain.global.load()});
+
+                if (slot->retired.size() % collect_period == 0)
+                    domain.collect(*slot);
+            }
+
+            /// Retires a node allocated with new.
+            template <typename Node>
+            void retire(Node *node)
+            {
+                retire(node, [](void *p) { delete static_cast<Node *>(p); });
+            }
+
+        private:
+            epoch_domain &domain;
+            Slot *slot;
+        };
+
+    private:
+        /// Claims a free slot of the table, starting from one picked by the thread id to avoid collisions, or else an overflow slot.
+        Slot *claim()
+        {
+            std::size_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % max_slots;
+
+            for (std::size_t k = 0; k < max_slots; k++)
+            {
+                Slot &slot = slots[(start + k) % max_slots];
+                if (try_own(slot))
+                    return &slot;
+            }
+
+            return claim_overflow();
+        }
+
+        /// Claims a free overflow slot, adding a new one if all of them are owned.
+        Slot *claim_overflow()
+        {
+            for (Slot *slot = overflow.load(); slot != nullptr; slot = slot->next)
+            {
+                if (try_own(*slot))
+                    return slot;
+            }
+
+            Slot *slot = new Slot;
+            slot->owned.store(true, std::memory_order_relaxed);
+            slot->next = overflow.load();
+            while (!overflow.compare_exchange_weak(slot->next, slot))
+            {
+            }
+
+            return slot;
+        }
+
+        /// Takes slot if no one owns it.
+        static bool try_own(Slot &slot)
+        {
+            bool expected = false;
+            return !slot.owned.load(std::memory_order_relaxed) &&
+                   slot.owned.compare_exchange_strong(expected, true, std::memory_order_acquire);
+        }
+
+        /// Advances the global epoch if every pinned slot has seen it.
+        void try_advance()
+        {
+            std::uint64_t current = global.load();
+
+            for (auto &slot : slots)
+            {
+                std::uint64_t e = slot.epoch.load();
+                if (e != idle && e != current)
+                    return;
+            }
+
+            for (Slot *slot = overflow.load(); slot != nullptr; slot = slot->next)
+            {
+                std::uint64_t e = slot->epoch.load();
+                if (e != idle && e != current)
+                    return;
+            }
+
+            global.compare_exchange_strong(current, current + 1);
+        }
+
+        /// Frees the nodes of a slot retired at least two epochs ago.
+        void collect(Slot &slot)
+        {
+            try_advance();
+            std::uint64_t safe = global.load();
+
+            auto &retired = slot.retired;
+            for (std::size_t i = 0; i < retired.size();)
+            {
+                if (retired[i].epoch + 2 <= safe)
+                {
+                    retired[i].deleter(retired[i].ptr);
+                    retired[i] = retired.back();
+                    retired.pop_back();
+                }
+                else
+                {
+                    i++;
+                }
+            }
+        }
+
+        std::atomic<std::uint64_t> global; //<! Global epoch
+        Slot slots[max_slots];
+        std::atomic<Slot *> overflow;      //<! Overflow slots, most recent first
+    };
+} // namespace sc
+
+#endif
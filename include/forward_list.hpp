@@ -0,0 +1,714 @@
+#ifndef FORWARD_LIST_H
+#define FORWARD_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "list.hpp"
+#include "stats.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Singly linked list with a tail pointer, for queue-like use.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Nodes only link to their successor, so each one is a pointer smaller than a node of
+     * sc::list and linking it writes half as many pointers. The list keeps a pointer to its last
+     * node, which makes push_back() and back() O(1) alongside push_front() and pop_front(), and
+     * lets splice_after() move a whole list in O(1). Like std::forward_list, positions are given
+     * by the node before them: before_begin() comes before the first element.
+     *
+     * Alloc and Stats work as in sc::list: nodes come from Alloc rebound to the node type, and
+     * the instrumentation policy (see stats.hpp) records allocations, the peak size and the hops
+     * of each operation.
+     */
+    template <typename T, typename Alloc = std::allocator<T>, typename Stats = no_stats>
+    class forward_list : private Stats
+    {
+    private:
+        /// Link shared by the head and the nodes.
+        struct NodeBase
+        {
+            NodeBase *next; //<! Pointer to the next node in the list, nullptr after the last one
+        };
+
+        /// Representation of a node, it contains a data and a reference to the next node.
+        struct Node : NodeBase
+        {
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field, constructed only while the node is in use
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+            const T &data() const { return *std::launder(reinterpret_cast<const T *>(storage)); }
+        };
+
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+    public:
+        /// Bytes of a node, for comparison with sc::list.
+        static constexpr size_type node_bytes = sizeof(Node);
+
+        /**
+         * @brief Constant iterator of a forward list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(current);
+                current = current->next;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+        protected:
+            NodeBase *current; //<! The node the iterator points to, nullptr at the end.
+            const_iterator(NodeBase *n) : current(n) {}
+            friend class forward_list;
+        };
+
+        /**
+         * @brief Iterator of a forward list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node, and to the stats of the list when they are recorded.
+         */
+        class iterator : private stats_ref<Stats>
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            /// Default constructor that creates an nullptr.
+            iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(*this);
+                current = current->next;
+                return temp;
+            }
+
+            /// Advances to the n-th successor node of the iterator and returns it.
+            friend iterator operator+(iterator it, int n)
+            {
+                for (int i = 0; i < n; i++)
+                    it.current = it.current->next;
+                it.hops(list_op::advance, n);
+                return it;
+            }
+
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current); }
+
+        protected:
+            NodeBase *current; //<! The node the iterator points to, nullptr at the end.
+            iterator(NodeBase *n, Stats *s = nullptr) : stats_ref<Stats>(s), current(n) {}
+            friend class forward_list;
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        forward_list() : forward_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its nodes from alloc.
+        explicit forward_list(const Alloc &a) : SIZE{0}, alloc{a}
+        {
+            head.next = nullptr;
+            tail = &head;
+        }
+
+        /// Constructs the list with count default-inserted instances of T.
+        explicit forward_list(size_type count, const Alloc &a = Alloc()) : forward_list(a)
+        {
+            for (size_type i = 0; i < count; i++)
+                emplace_back();
+        }
+
+        /// Constructs the list with the contents of the range [first, last).
+        template <typename InputIt>
+        forward_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : forward_list(a)
+        {
+            while (first != last)
+                emplace_back(*(first++));
+        }
+
+        /// Constructs the list with the contents of the initializer list init.
+        forward_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : forward_list(ilist.begin(), ilist.end(), a) {}
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other.
+        forward_list(const forward_list &other)
+            : forward_list(other.begin(), other.end(), Alloc(node_traits::select_on_container_copy_construction(other.alloc)))
+        {
+        }
+
+        /// Move constructor. Takes over the nodes of other in O(1), leaving other empty.
+        forward_list(forward_list &&other) noexcept : forward_list(Alloc(other.alloc))
+        {
+            take_nodes(other);
+        }
+
+        /// Destructor
+        ~forward_list()
+        {
+            clear();
+        }
+
+        /// Copy the size and values from another list.
+        forward_list &operator=(const forward_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto &value : other)
+                    emplace_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the nodes of other, leaving it empty. O(1) unless the allocators differ and do not propagate.
+        forward_list &operator=(forward_list &&other) noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            if (node_traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = other.alloc;
+                take_nodes(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                take_nodes(other);
+            }
+            else
+            {
+                for (auto &value : other)
+                    emplace_back(std::move(value));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        /// Replaces the contents with those identified by initializer list ilist.
+        forward_list &operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            for (const T &value : ilist)
+                emplace_back(value);
+
+            return *this;
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        /// Returns the instrumentation policy, which holds what has been recorded so far.
+        const Stats &stats() const
+        {
+            return *this;
+        }
+
+        Stats &stats()
+        {
+            return *this;
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator to the position before the first element, for insert_after() and erase_after().
+        iterator before_begin()
+        {
+            return iterator(&head, this);
+        }
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(head.next, this);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(nullptr, this);
+        }
+
+        /// Returns an iterator to the last element, the position for appending with insert_after() or splice_after().
+        iterator before_end()
+        {
+            return iterator(tail, this);
+        }
+
+        /// Returns a constant iterator to the position before the first element.
+        const_iterator before_begin() const
+        {
+            return cbefore_begin();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator to the position before the first element.
+        const_iterator cbefore_begin() const
+        {
+            return const_iterator(const_cast<NodeBase *>(&head));
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(head.next);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(nullptr);
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        // [IV] MODIFIERS
+
+        /// Remove all elements from the container.
+        void clear()
+        {
+            NodeBase *curNode = head.next;
+
+            while (curNode != nullptr)
+            {
+                NodeBase *nxt = curNode->next;
+                destroy_node(node(curNode));
+                curNode = nxt;
+            }
+
+            head.next = nullptr;
+            tail = &head;
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return node(head.next)->data();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return node(head.next)->data();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return node(tail)->data();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return node(tail)->data();
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            emplace_after(before_begin(), value);
+        }
+
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace_after(before_begin(), std::move(value));
+        }
+
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return *emplace_after(before_begin(), std::forward<Args>(args)...);
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            emplace_after(before_end(), value);
+        }
+
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace_after(before_end(), std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return *emplace_after(before_end(), std::forward<Args>(args)...);
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase_after(before_begin());
+        }
+
+        /// Adds value into the list after pos and returns an iterator to the inserted item.
+        iterator insert_after(const_iterator pos, const T &value)
+        {
+            return emplace_after(pos, value);
+        }
+
+        /// Moves value into the list after pos and returns an iterator to the inserted item.
+        iterator insert_after(const_iterator pos, T &&value)
+        {
+            return emplace_after(pos, std::move(value));
+        }
+
+        /// Inserts elements from the range [first; last) after pos and returns an iterator to the last inserted item, or pos.
+        template <class InItr>
+        iterator insert_after(const_iterator pos, InItr first, InItr last)
+        {
+            iterator it(pos.current, this);
+            for (; first != last; ++first)
+                it = emplace_after(it, *first);
+
+            return it;
+        }
+
+        /// Inserts elements from the initializer list ilist after pos and returns an iterator to the last inserted item, or pos.
+        iterator insert_after(const_iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert_after(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Constructs an element in place after pos and returns an iterator to it.
+        template <typename... Args>
+        iterator emplace_after(const_iterator pos, Args &&...args)
+        {
+            Node *newNode = create_node(std::forward<Args>(args)...);
+            NodeBase *at = pos.current;
+
+            newNode->next = at->next;
+            at->next = newNode;
+            if (at == tail)
+                tail = newNode;
+            SIZE++;
+            stats().on_grow(SIZE);
+            stats().on_hops(list_op::insert, 0);
+
+            return iterator(newNode, this);
+        }
+
+        /// Removes the element after pos and returns an iterator to the element that follows it.
+        iterator erase_after(const_iterator pos)
+        {
+            NodeBase *at = pos.current;
+            NodeBase *delNode = at->next;
+
+            at->next = delNode->next;
+            if (delNode == tail)
+                tail = at;
+            destroy_node(node(delNode));
+            SIZE--;
+            stats().on_hops(list_op::erase, 0);
+
+            return iterator(at->next, this);
+        }
+
+        /// Removes the elements in the open range (first, last) and returns last.
+        iterator erase_after(const_iterator first, const_iterator last)
+        {
+            NodeBase *at = first.current;
+            NodeBase *curNode = at->next;
+            size_type hops = 0;
+
+            while (curNode != last.current)
+            {
+                NodeBase *nxt = curNode->next;
+                destroy_node(node(curNode));
+                curNode = nxt;
+                SIZE--;
+                hops++;
+            }
+
+            at->next = last.current;
+            if (last.current == nullptr)
+                tail = at;
+            stats().on_hops(list_op::erase, hops);
+
+            return iterator(last.current, this);
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const forward_list &lhs, const forward_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (const NodeBase *l = lhs.head.next, *r = rhs.head.next; l != nullptr; l = l->next, r = r->next)
+            {
+                if (!(node(l)->data() == node(r)->data()))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const forward_list &lhs, const forward_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // [V] OPERATIONS
+        // They only relink existing nodes: nothing is allocated, copied or moved.
+
+        /// Moves every element of other after pos in O(1). other must use an equal allocator.
+        void splice_after(const_iterator pos, forward_list &other)
+        {
+            if (&other == this || other.SIZE == 0)
+                return;
+
+            NodeBase *at = pos.current;
+            other.tail->next = at->next;
+            at->next = other.head.next;
+            if (at == tail)
+                tail = other.tail;
+
+            SIZE += other.SIZE;
+            stats().on_grow(SIZE);
+            stats().on_hops(list_op::splice, 0);
+
+            other.head.next = nullptr;
+            other.tail = &other.head;
+            other.SIZE = 0;
+        }
+
+        void splice_after(const_iterator pos, forward_list &&other)
+        {
+            splice_after(pos, other);
+        }
+
+        /// Moves the element after it, in other, to the position after pos in O(1).
+        void splice_after(const_iterator pos, forward_list &other, const_iterator it)
+        {
+            NodeBase *before = it.current;
+            if (pos.current == before || pos.current == before->next)
+                return;
+
+            transfer(other, pos.current, before, before->next, 1);
+        }
+
+        /// Moves the elements in the open range (first, last) of other after pos. The range is walked once to find its end.
+        void splice_after(const_iterator pos, forward_list &other, const_iterator first, const_iterator last)
+        {
+            NodeBase *before = first.current;
+            if (before->next == last.current)
+                return;
+
+            size_type count = 1;
+            NodeBase *lastNode = before->next;
+            for (; lastNode->next != last.current; lastNode = lastNode->next)
+                count++;
+            stats().on_hops(list_op::splice, count);
+
+            transfer(other, pos.current, before, lastNode, count);
+        }
+
+    private:
+        /// Downcasts a link to the node that holds it. Must not be called on the head.
+        static Node *node(NodeBase *link)
+        {
+            return static_cast<Node *>(link);
+        }
+
+        static const Node *node(const NodeBase *link)
+        {
+            return static_cast<const Node *>(link);
+        }
+
+        /// Allocates a node through the node allocator and constructs its data from args.
+        template <typename... Args>
+        Node *create_node(Args &&...args)
+        {
+            Node *newNode = node_traits::allocate(alloc, 1);
+            stats().on_allocate();
+
+            try
+            {
+                node_traits::construct(alloc, newNode->data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc, newNode, 1);
+                stats().on_deallocate();
+                throw;
+            }
+
+            return newNode;
+        }
+
+        /// Destroys the data of a node and gives its memory back to the node allocator.
+        void destroy_node(Node *oldNode)
+        {
+            node_traits::destroy(alloc, oldNode->data_ptr());
+            node_traits::deallocate(alloc, oldNode, 1);
+            stats().on_deallocate();
+        }
+
+        /// Moves the count nodes after before, up to lastNode, from other to after pos, keeping both tails right.
+        void transfer(forward_list &other, NodeBase *pos, NodeBase *before, NodeBase *lastNode, size_type count)
+        {
+            NodeBase *firstNode = before->next;
+
+            // Unlink [firstNode, lastNode] from other...
+            before->next = lastNode->next;
+            if (lastNode == other.tail)
+                other.tail = before;
+
+            // ...and link it after pos.
+            lastNode->next = pos->next;
+            pos->next = firstNode;
+            if (pos == tail)
+                tail = lastNode;
+
+            if (&other != this)
+            {
+                other.SIZE -= count;
+                SIZE += count;
+                stats().on_grow(SIZE);
+            }
+        }
+
+        /// Moves every node of other to this list, which must be empty, and leaves other empty.
+        void take_nodes(forward_list &other)
+        {
+            if (other.SIZE == 0)
+                return;
+
+            head.next = other.head.next;
+            tail = other.tail;
+            SIZE = other.SIZE;
+            stats().on_grow(SIZE);
+
+            other.head.next = nullptr;
+            other.tail = &other.head;
+            other.SIZE = 0;
+        }
+
+        size_type SIZE;
+        node_allocator alloc;
+        NodeBase head;  //<! Before the first node, its next is the first node
+        NodeBase *tail; //<! The last node, or the head if the list is empty
+    };
+} // namespace sc
+
+#endif
@@ -0,0 +1,708 @@
+#ifndef INDEXED_LIST_H
+#define INDEXED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /// Key of an element that is its own key.
+    struct identity_key
+    {
+        template <typename U>
+        const U &operator()(const U &value) const { return value; }
+    };
+
+    /**
+     * @brief Doubly linked list of unique elements with a hash index from key to node.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Iteration follows the order in which the elements were linked, as in sc::list, while
+     * find(), contains(), erase(key) and move_to_front() go through the index in O(1) expected
+     * time. The key of an element is KeyOf(element), the element itself by default; an element
+     * whose key is already in the list is not inserted.
+     *
+     * Each node is in the list order and in the chain of its bucket, and caches the hash of its
+     * key, so growing the index never calls Hash again. Elements cannot be changed through
+     * iterators, as that could change their keys.
+     */
+    template <typename T, typename Hash = std::hash<T>, typename KeyOf = identity_key, typename KeyEqual = std::equal_to<>,
+              typename Alloc = std::allocator<T>>
+    class indexed_list
+    {
+    public:
+        using key_type = std::decay_t<decltype(std::declval<KeyOf>()(std::declval<const T &>()))>;
+
+    private:
+        /// Links shared by the sentinel and the nodes.
+        struct NodeBase
+        {
+            NodeBase *prev; //<! Pointer to the previous node in the list
+            NodeBase *next; //<! Pointer to the next node in the list
+        };
+
+        /// Representation of a node, in the list order and in a bucket of the index.
+        struct Node : NodeBase
+        {
+            Node *bucket_next;                           //<! Next node of the same bucket
+            std::size_t hash;                            //<! Hash of the key
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+        };
+
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+        using bucket_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node *>;
+        using bucket_traits = std::allocator_traits<bucket_allocator>;
+
+        static constexpr size_type min_buckets = 8;
+
+    public:
+        /**
+         * @brief Constant iterator of an indexed list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Return a pointer to the object located at the position pointed by the iterator.
+            const T *operator->() const { return &**this; }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(*this);
+                current = current->next;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator and returns it.
+            friend const_iterator operator+(int n, const_iterator it)
+            {
+                return it + n;
+            }
+
+            friend const_iterator operator+(const_iterator it, int n)
+            {
+                for (int i = 0; i < n; i++)
+                    it.current = it.current->next;
+
+                return it;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(*this);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Returns the distance between the elements (not between the adresses).
+            size_type operator-(const_iterator rhs) const
+            {
+                size_type dis = 0;
+
+                for (; rhs.current != current; rhs.current = rhs.current->next)
+                    dis++;
+
+                return dis;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+        protected:
+            NodeBase *current;                                   //<! The pointer to the node.
+            explicit const_iterator(NodeBase *p) : current(p) {} //<! Constructor that receives a pointer.
+            friend class indexed_list;                           //<! List can access members of iterator.
+        };
+
+        /// Elements are read-only through iterators, as in std::unordered_set.
+        using iterator = const_iterator;
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        indexed_list() : indexed_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its nodes and its index from a.
+        explicit indexed_list(const Alloc &a, const Hash &h = Hash(), const KeyEqual &eq = KeyEqual())
+            : SIZE{0}, buckets{nullptr}, n_buckets{0}, shift{0}, alloc{a}, hash{h}, equal{eq}
+        {
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+        }
+
+        /// Constructs the list with the elements of the range [first, last), skipping repeated keys.
+        template <typename InputIt>
+        indexed_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : indexed_list(a)
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        /// Constructs the list with the elements of the initializer list ilist, skipping repeated keys.
+        indexed_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : indexed_list(ilist.begin(), ilist.end(), a) {}
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other.
+        indexed_list(const indexed_list &other)
+            : indexed_list(Alloc(node_traits::select_on_container_copy_construction(other.alloc)), other.hash, other.equal)
+        {
+            reserve(other.SIZE);
+            for (const T &value : other)
+                push_back(value);
+        }
+
+        /// Move constructor. Takes over the nodes and the index of other in O(1), leaving other empty.
+        indexed_list(indexed_list &&other) noexcept(std::is_nothrow_copy_constructible<Hash>::value && std::is_nothrow_copy_constructible<KeyEqual>::value) : indexed_list(Alloc(other.alloc), other.hash, other.equal)
+        {
+            take_nodes(other);
+        }
+
+        /// Destructor
+        ~indexed_list()
+        {
+            clear();
+            release_buckets();
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        /// Copy the elements of another list.
+        indexed_list &operator=(const indexed_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                hash = other.hash;
+                equal = other.equal;
+                reserve(other.SIZE);
+                for (const T &value : other)
+                    push_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the nodes of other, with its Hash and KeyEqual, leaving it empty. O(1) unless the allocators differ and do not propagate.
+        indexed_list &operator=(indexed_list &&other) noexcept((node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) &&
+                                                              std::is_nothrow_move_assignable<Hash>::value && std::is_nothrow_move_assignable<KeyEqual>::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            // The nodes of other cache hashes computed by other.hash, so the functors go with them.
+            if (node_traits::propagate_on_container_move_assignment::value)
+            {
+                release_buckets();
+                alloc = other.alloc;
+                hash = std::move(other.hash);
+                equal = std::move(other.equal);
+                take_nodes(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                release_buckets();
+                hash = std::move(other.hash);
+                equal = std::move(other.equal);
+                take_nodes(other);
+            }
+            else
+            {
+                // The elements are hashed again, by the same functors as in the other branches.
+                hash = other.hash;
+                equal = other.equal;
+                reserve(other.SIZE);
+                for (NodeBase *cur = other.sentinel.next; cur != &other.sentinel; cur = cur->next)
+                    push_back(std::move(node(cur)->data()));
+
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return const_iterator(sentinel.next);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return const_iterator(const_cast<NodeBase *>(&sentinel));
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        /// Number of buckets of the index.
+        size_type bucket_count() const
+        {
+            return n_buckets;
+        }
+
+        /// Grows the index, if needed, so that count elements fit without rehashing.
+        void reserve(size_type count)
+        {
+            if (count > n_buckets)
+                rehash(count);
+        }
+
+        // [IV] LOOKUP
+
+        /// Returns an iterator to the element with the given key, or end() if there is none. O(1) expected.
+        const_iterator find(const key_type &key) const
+        {
+            Node *n = lookup(key, hash(key));
+            return n != nullptr ? const_iterator(n) : end();
+        }
+
+        /// Returns true if an element has the given key. O(1) expected.
+        bool contains(const key_type &key) const
+        {
+            return lookup(key, hash(key)) != nullptr;
+        }
+
+        // [V] MODIFIERS
+
+        /// Remove all elements from the container. The index keeps its buckets.
+        void clear()
+        {
+            NodeBase *cur = sentinel.next;
+
+            while (cur != &sentinel)
+            {
+                NodeBase *nxt = cur->next;
+                destroy_node(node(cur));
+                cur = nxt;
+            }
+
+            sentinel.next = &sentinel;
+            sentinel.prev = &sentinel;
+            for (size_type b = 0; b < n_buckets; b++)
+                buckets[b] = nullptr;
+
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return node(sentinel.next)->data();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return node(sentinel.prev)->data();
+        }
+
+        /// Adds value to the front of the list. Returns the element with its key and whether it was inserted.
+        std::pair<const_iterator, bool> push_front(const T &value)
+        {
+            return emplace(begin(), value);
+        }
+
+        std::pair<const_iterator, bool> push_front(T &&value)
+        {
+            return emplace(begin(), std::move(value));
+        }
+
+        /// Adds value to the back of the list. Returns the element with its key and whether it was inserted.
+        std::pair<const_iterator, bool> push_back(const T &value)
+        {
+            return emplace(end(), value);
+        }
+
+        std::pair<const_iterator, bool> push_back(T &&value)
+        {
+            return emplace(end(), std::move(value));
+        }
+
+        /// Adds value before pos, unless its key is in the list. Returns the element with that key and whether it was inserted.
+        std::pair<const_iterator, bool> insert(const_iterator pos, const T &value)
+        {
+            return emplace(pos, value);
+        }
+
+        std::pair<const_iterator, bool> insert(const_iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        /// Constructs an element before pos, and keeps it unless its key is in the list.
+        template <typename... Args>
+        std::pair<const_iterator, bool> emplace(const_iterator pos, Args &&...args)
+        {
+            Node *n = create_node(std::forward<Args>(args)...);
+
+            try
+            {
+                const key_type &key = KeyOf()(n->data());
+                n->hash = hash(key);
+
+                if (Node *found = lookup(key, n->hash))
+                {
+                    destroy_node(n);
+                    return {const_iterator(found), false};
+                }
+
+                reserve(SIZE + 1);
+            }
+            catch (...)
+            {
+                destroy_node(n);
+                throw;
+            }
+
+            link_before(pos.current, n);
+            index(n);
+            SIZE++;
+
+            return {const_iterator(n), true};
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase(const_iterator(sentinel.prev));
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        const_iterator erase(const_iterator pos)
+        {
+            Node *n = node(pos.current);
+            NodeBase *nxt = n->next;
+
+            unindex(n);
+            unlink(n);
+            destroy_node(n);
+            SIZE--;
+
+            return const_iterator(nxt);
+        }
+
+        /// Removes elements in the range [first; last).
+        const_iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+
+            return last;
+        }
+
+        /// Removes the element with the given key and returns how many were removed (0 or 1). O(1) expected.
+        size_type erase(const key_type &key)
+        {
+            Node *n = lookup(key, hash(key));
+            if (n == nullptr)
+                return 0;
+
+            erase(const_iterator(n));
+            return 1;
+        }
+
+        /// Moves the element with the given key to the front of the list in O(1) expected. Returns false if there is none.
+        bool move_to_front(const key_type &key)
+        {
+            Node *n = lookup(key, hash(key));
+            if (n == nullptr)
+                return false;
+
+            move_to_front(const_iterator(n));
+            return true;
+        }
+
+        /// Moves the element at pos to the front of the list in O(1).
+        void move_to_front(const_iterator pos)
+        {
+            if (pos.current == sentinel.next)
+                return;
+
+            unlink(pos.current);
+            link_before(sentinel.next, pos.current);
+        }
+
+        /// Moves the element at pos to the back of the list in O(1).
+        void move_to_back(const_iterator pos)
+        {
+            if (pos.current == sentinel.prev)
+                return;
+
+            unlink(pos.current);
+            link_before(&sentinel, pos.current);
+        }
+
+        /// Returns true if both lists hold equal elements in the same order.
+        friend bool operator==(const indexed_list &lhs, const indexed_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (!(*l == *r))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const indexed_list &lhs, const indexed_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// Downcasts a link to the node that holds it. Must not be called on the sentinel.
+        static Node *node(NodeBase *link)
+        {
+            return static_cast<Node *>(link);
+        }
+
+        static const Node *node(const NodeBase *link)
+        {
+            return static_cast<const Node *>(link);
+        }
+
+        /// Bucket of a hash: Fibonacci hashing keeps the high bits, so weak hashes such as std::hash<int> spread too.
+        size_type bucket(std::size_t h) const
+        {
+            return static_cast<size_type>((static_cast<std::uint64_t>(h) * 0x9E3779B97F4A7C15ull) >> shift);
+        }
+
+        /// Returns the node whose key is equal to key, which hashes to h, or nullptr.
+        Node *lookup(const key_type &key, std::size_t h) const
+        {
+            if (n_buckets == 0)
+                return nullptr;
+
+            for (Node *n = buckets[bucket(h)]; n != nullptr; n = n->bucket_next)
+            {
+                if (n->hash == h && equal(KeyOf()(n->data()), key))
+                    return n;
+            }
+
+            return nullptr;
+        }
+
+        /// Adds n to the chain of its bucket.
+        void index(Node *n)
+        {
+            Node *&head = buckets[bucket(n->hash)];
+            n->bucket_next = head;
+            head = n;
+        }
+
+        /// Removes n from the chain of its bucket.
+        void unindex(Node *n)
+        {
+            Node **link = &buckets[bucket(n->hash)];
+            while (*link != n)
+                link = &(*link)->bucket_next;
+
+            *link = n->bucket_next;
+        }
+
+        /// Links n right before pos.
+        static void link_before(NodeBase *pos, NodeBase *n)
+        {
+            n->prev = pos->prev;
+            n->next = pos;
+            pos->prev->next = n;
+            pos->prev = n;
+        }
+
+        /// Takes n out of the list order.
+        static void unlink(NodeBase *n)
+        {
+            n->prev->next = n->next;
+            n->next->prev = n->prev;
+        }
+
+        /// Rebuilds the index with the smallest power of two of buckets that is at least count.
+        void rehash(size_type count)
+        {
+            size_type n = min_buckets;
+            unsigned bits = 3;
+            while (n < count)
+            {
+                n *= 2;
+                bits++;
+            }
+
+            bucket_allocator ba(alloc);
+            Node **grown = bucket_traits::allocate(ba, n);
+            for (size_type b = 0; b < n; b++)
+                grown[b] = nullptr;
+
+            release_buckets();
+            buckets = grown;
+            n_buckets = n;
+            shift = 64 - bits;
+
+            for (NodeBase *cur = sentinel.next; cur != &sentinel; cur = cur->next)
+                index(node(cur));
+        }
+
+        /// Gives the bucket array back to the allocator.
+        void release_buckets()
+        {
+            if (buckets != nullptr)
+            {
+                bucket_allocator ba(alloc);
+                bucket_traits::deallocate(ba, buckets, n_buckets);
+            }
+
+            buckets = nullptr;
+            n_buckets = 0;
+            shift = 0;
+        }
+
+        /// Allocates a node through the node allocator and constructs its data from args.
+        template <typename... Args>
+        Node *create_node(Args &&...args)
+        {
+            Node *n = node_traits::allocate(alloc, 1);
+
+            try
+            {
+                node_traits::construct(alloc, n->data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc, n, 1);
+                throw;
+            }
+
+            return n;
+        }
+
+        /// Destroys the data of a node and gives its memory back to the node allocator.
+        void destroy_node(Node *n)
+        {
+            node_traits::destroy(alloc, n->data_ptr());
+            node_traits::deallocate(alloc, n, 1);
+        }
+
+        /// Moves the nodes and the index of other to this list, which must be empty and have no buckets.
+        void take_nodes(indexed_list &other)
+        {
+            buckets = other.buckets;
+            n_buckets = other.n_buckets;
+            shift = other.shift;
+            other.buckets = nullptr;
+            other.n_buckets = 0;
+            other.shift = 0;
+
+            if (other.SIZE == 0)
+                return;
+
+            sentinel.next = other.sentinel.next;
+            sentinel.prev = other.sentinel.prev;
+            sentinel.next->prev = &sentinel;
+            sentinel.prev->next = &sentinel;
+            SIZE = other.SIZE;
+
+            other.sentinel.next = &other.sentinel;
+            other.sentinel.prev = &other.sentinel;
+            other.SIZE = 0;
+        }
+
+        size_type SIZE;
+        NodeBase sentinel;        //<! End mark, its next is the first node and its prev is the last one
+        Node **buckets;           //<! Heads of the bucket chains
+        size_type n_buckets;      //<! A power of two, or 0 before the first insertion
+        unsigned shift;           //<! 64 - log2(n_buckets), to take the top bits of the mixed hash
+        node_allocator alloc;
+        Hash hash;
+        KeyEqual equal;
+    };
+} // namespace sc
+
+#endif
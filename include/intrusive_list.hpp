@@ -0,0 +1,500 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Links that an object keeps inside itself to take part of an sc::intrusive_list.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Copying an object does not copy its membership: a copied or assigned hook is unlinked.
+     */
+    struct list_hook
+    {
+        list_hook *prev; //<! Pointer to the previous hook in the list
+        list_hook *next; //<! Pointer to the next hook in the list
+
+        list_hook() : prev{nullptr}, next{nullptr} {}
+        list_hook(const list_hook &) : list_hook() {}
+        list_hook &operator=(const list_hook &) { return *this; }
+
+        /// Returns true if the object is in a list.
+        bool is_linked() const { return next != nullptr; }
+    };
+
+    /**
+     * @brief Doubly linked list whose links live inside the elements.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * The list only links objects that the caller owns, through their Hook member, so it never
+     * allocates and never copies or destroys an element. An object can be in as many lists at
+     * the same time as it has hooks, and can be unlinked in O(1) from a reference to it. An object
+     * must be erased from its list before being destroyed.
+     *
+     * Iteration works like in sc::list, except that iterators refer to the objects themselves.
+     */
+    template <typename T, list_hook T::*Hook>
+    class intrusive_list
+    {
+    public:
+        /**
+         * @brief Constant iterator of an intrusive list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a hook.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return *owner(current); }
+
+            /// Return a pointer to the object located at the position pointed by the iterator.
+            const T *operator->() const { return owner(current); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(current);
+                current = current->next;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(current);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+        protected:
+            list_hook *current;                                  //<! The hook of the object.
+            explicit const_iterator(list_hook *p) : current(p) {} //<! Constructor that receives a pointer.
+            friend class intrusive_list;                          //<! List can access members of iterator.
+        };
+
+        /**
+         * @brief Iterator of an intrusive list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a hook.
+         */
+        class iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            iterator() : current(nullptr) {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() const { return *owner(current); }
+
+            /// Return a pointer to the object located at the position pointed by the iterator.
+            T *operator->() const { return owner(current); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(current);
+                current = current->next;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator and returns it.
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            friend iterator operator+(iterator it, int n)
+            {
+                for (int i = 0; i < n; i++)
+                    it.current = it.current->next;
+
+                return it;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(current);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Returns the distance between the objects (not between the adresses).
+            size_type operator-(iterator rhs) const
+            {
+                size_type dis = 0;
+
+                for (; rhs.current != current; rhs.current = rhs.current->next)
+                    dis++;
+
+                return dis;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current); }
+
+        protected:
+            list_hook *current;                            //<! The hook of the object.
+            explicit iterator(list_hook *p) : current(p) {} //<! Constructor that receives a pointer.
+            friend class intrusive_list;                    //<! List can access members of iterator.
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        intrusive_list() : SIZE{0}
+        {
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+        }
+
+        intrusive_list(const intrusive_list &) = delete;
+        intrusive_list &operator=(const intrusive_list &) = delete;
+
+        /// Move constructor. Takes over the objects of other in O(1), leaving other empty.
+        intrusive_list(intrusive_list &&other) noexcept : intrusive_list()
+        {
+            take_hooks(other);
+        }
+
+        /// Takes over the objects of other, unlinking the current ones.
+        intrusive_list &operator=(intrusive_list &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                take_hooks(other);
+            }
+
+            return *this;
+        }
+
+        /// Destructor. Unlinks every object, none of them is destroyed.
+        ~intrusive_list()
+        {
+            clear();
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first object in the list.
+        iterator begin()
+        {
+            return iterator(sentinel.next);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(&sentinel);
+        }
+
+        /// Returns a constant iterator pointing to the first object in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first object in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(sentinel.next);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(const_cast<list_hook *>(&sentinel));
+        }
+
+        /// Returns an iterator pointing to value, which must be in this list. O(1).
+        static iterator iterator_to(T &value)
+        {
+            return iterator(&(value.*Hook));
+        }
+
+        /// Returns a constant iterator pointing to value, which must be in this list. O(1).
+        static const_iterator iterator_to(const T &value)
+        {
+            return const_iterator(const_cast<list_hook *>(&(value.*Hook)));
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of objects in the list.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the list contains no objects, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        // [IV] MODIFIERS
+
+        /// Unlinks every object from the list.
+        void clear()
+        {
+            list_hook *cur = sentinel.next;
+
+            while (cur != &sentinel)
+            {
+                list_hook *nxt = cur->next;
+                cur->prev = cur->next = nullptr;
+                cur = nxt;
+            }
+
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return *begin();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return *cbegin();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return *iterator(sentinel.prev);
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return *const_iterator(sentinel.prev);
+        }
+
+        /// Links value at the front of the list.
+        void push_front(T &value)
+        {
+            insert(begin(), value);
+        }
+
+        /// Links value at the back of the list.
+        void push_back(T &value)
+        {
+            insert(end(), value);
+        }
+
+        /// Unlinks the object at the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Unlinks the object at the back of the list.
+        void pop_back()
+        {
+            erase(iterator(sentinel.prev));
+        }
+
+        /// Links value, which must not be in a list through Hook, before pos and returns an iterator to it.
+        iterator insert(iterator pos, T &value)
+        {
+            list_hook *h = &(value.*Hook);
+            list_hook *p = pos.current;
+            record_offset(value, h);
+
+            h->prev = p->prev;
+            h->next = p;
+            p->prev->next = h;
+            p->prev = h;
+            SIZE++;
+
+            return iterator(h);
+        }
+
+        /// Unlinks the object at pos and returns an iterator to the object that followed it.
+        iterator erase(iterator pos)
+        {
+            list_hook *h = pos.current;
+            list_hook *nxt = h->next;
+
+            h->prev->next = nxt;
+            nxt->prev = h->prev;
+            h->prev = h->next = nullptr;
+            SIZE--;
+
+            return iterator(nxt);
+        }
+
+        /// Unlinks the objects in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+
+            return last;
+        }
+
+        /// Unlinks value, which must be in this list, in O(1).
+        void erase(T &value)
+        {
+            erase(iterator_to(value));
+        }
+
+        /// Moves every object of other before pos in O(1), leaving other empty.
+        void splice(iterator pos, intrusive_list &other)
+        {
+            if (other.SIZE == 0 || &other == this)
+                return;
+
+            list_hook *first = other.sentinel.next;
+            list_hook *last = other.sentinel.prev;
+            list_hook *p = pos.current;
+
+            first->prev = p->prev;
+            last->next = p;
+            p->prev->next = first;
+            p->prev = last;
+            SIZE += other.SIZE;
+
+            other.sentinel.prev = &other.sentinel;
+            other.sentinel.next = &other.sentinel;
+            other.SIZE = 0;
+        }
+
+        /// Returns true if each object of a list is equal to another.
+        friend bool operator==(const intrusive_list &lhs, const intrusive_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (!(*l == *r))
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one object of a list is different to another.
+        friend bool operator!=(const intrusive_list &lhs, const intrusive_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// Measures the offset of Hook on value, the object holding h, unless an earlier object already did.
+        static void record_offset(T &value, list_hook *h)
+        {
+            if (hook_offset.load(std::memory_order_relaxed) < 0)
+                hook_offset.store(reinterpret_cast<unsigned char *>(h) - reinterpret_cast<unsigned char *>(std::addressof(value)), std::memory_order_relaxed);
+        }
+
+        /// Returns the object that holds the hook h. Only linked hooks are passed, so the offset is known.
+        static T *owner(list_hook *h)
+        {
+            return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(h) - hook_offset.load(std::memory_order_relaxed));
+        }
+
+        /// Moves every object of other to this list, which must be empty, and leaves other empty.
+        void take_hooks(intrusive_list &other)
+        {
+            if (other.SIZE == 0)
+                return;
+
+            sentinel.next = other.sentinel.next;
+            sentinel.prev = other.sentinel.prev;
+            sentinel.next->prev = &sentinel;
+            sentinel.prev->next = &sentinel;
+            SIZE = other.SIZE;
+
+            other.sentinel.prev = &other.sentinel;
+            other.sentinel.next = &other.sentinel;
+            other.SIZE = 0;
+        }
+
+        /// Offset of Hook inside T, the same for every object; measured on the first object linked, as T may not be standard layout.
+        static inline std::atomic<std::ptrdiff_t> hook_offset{-1};
+
+        size_type SIZE;
+        list_hook sentinel; //<! End mark, its next is the first hook and its prev is the last one
+    };
+} // namespace sc
+
+#endif
@@ -1,8 +1,18 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
-#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "stats.hpp"
+#include "traversal.hpp"
 
 using size_type = unsigned long;
 
@@ -12,44 +22,103 @@ namespace sc
     /**
      * @brief Container that implements a doubly linked list.
      * @author Eduardo Sarmento & Victor Vieira
-     * 
+     *
      * This class is similar to std::list, having some constructors, operations, etc.
+     * Nodes are obtained from Alloc (rebound to the node type), so a sc::slab_allocator or a
+     * std::pmr::polymorphic_allocator can be plugged in to avoid a malloc/free per element.
+     * The end mark is a link-only sentinel stored inside the list, so an empty list allocates
+     * nothing and T does not need to be default-constructible.
+     *
+     * The count, range (of forward iterators), initializer list and copy constructors allocate
+     * all their nodes as one block and link them in address order. Every node points to the
+     * header of its block (or holds nullptr), which counts the nodes still in use, so block nodes
+     * are erased and spliced like any other and the block goes back to the allocator with the
+     * last of them, whichever list it is in by then.
+     *
+     * reserve(n) makes the list keep the nodes of erased elements, up to n of them, as spare nodes
+     * that later insertions reuse without calling the allocator; shrink_to_fit() gives them back.
+     * The assignments overwrite the elements in the nodes the list already has and only allocate
+     * or free the difference.
+     *
+     * Stats is an instrumentation policy (see stats.hpp). The default sc::no_stats records
+     * nothing and adds nothing to the list or to its iterators; sc::list_stats counts calls to
+     * the allocator, the peak size and the node hops of each operation, read through stats().
      */
-    template <typename T>
-    class list
+    template <typename T, typename Alloc = std::allocator<T>, typename Stats = no_stats>
+    class list : private Stats
     {
     private:
+        /// Links shared by the sentinel and the nodes.
+        struct NodeBase
+        {
+            NodeBase *prev; //<! Pointer to the previous node in the list
+            NodeBase *next; //<! Pointer to the next node in the list
+        };
+
+        /// Header of nodes allocated together, stored in place of the first node(s) of the allocation.
+        struct Block
+        {
+            size_type count; //<! Nodes that follow the header
+            size_type live;  //<! Nodes of the block that hold an element or are spare nodes of a list
+        };
+
         /// Representation of a node, it contains a data and references to the previous and the next node.
-        struct Node
+        struct Node : NodeBase
+        {
+            Block *block;                                //<! Block the node was allocated in, or nullptr if it was allocated on its own
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field, constructed only while the node is in use
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+            const T &data() const { return *std::launder(reinterpret_cast<const T *>(storage)); }
+        };
+
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+        /// True for iterators that can be traversed twice, so the range can be counted before it is copied.
+        template <typename It, typename = void>
+        struct is_forward : std::false_type
         {
-            T data;     //<! Data field
-            Node *prev; //<! Pointer to the previous node in the list
-            Node *next; //<! Pointer to the next node in the list
+        };
 
-            /// Basic constructor
-            Node(const T &d = T(), Node *p = nullptr, Node *n = nullptr) : data{d}, prev{p}, next{n} {}
+        template <typename It>
+        struct is_forward<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+            : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>
+        {
         };
 
+        static constexpr size_type block_header_nodes = (sizeof(Block) + sizeof(Node) - 1) / sizeof(Node);
+
     public:
         /**
          * @brief Constant iterator of a node.
          * @author Eduardo Sarmento & Victor Vieira
-         * 
+         *
          * Encapsulates a pointer to a node.
          */
         class const_iterator {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
             /// Default constructor that creates an nullptr.
             const_iterator() : current{nullptr} {}
 
             /// Return a reference to the object located at the position pointed by the iterator.
-            const T &operator*() const { return *current; } // *it
+            const T &operator*() const { return static_cast<Node *>(current)->data(); } // *it
 
             /// Advances the iterator to the next location within the list and returns itself after that.
             const_iterator &operator++() // ++it;
             {
                 current = current->next;
-                return current;
+                return *this;
             }
 
             /// Advances the iterator to the next location within the list and returns itself before that.
@@ -64,7 +133,7 @@ namespace sc
             const_iterator &operator--() // --it;
             {
                 current = current->prev;
-                return const_iterator(current);
+                return *this;
             }
 
             /// Backs the iterator to the previous location within the list and returns itself before that.
@@ -88,40 +157,46 @@ namespace sc
             }
 
         protected:
-            Node *current;                          //<! The pointer to the node.
-            const_iterator(Node *p) : current(p) {} //<! Constructor that receives a pointer.
-            friend class list<T>;                   //<! List can access members of iterator.
+            NodeBase *current;                          //<! The pointer to the node.
+            const_iterator(NodeBase *p) : current(p) {} //<! Constructor that receives a pointer.
+            friend class list;                          //<! List can access members of iterator.
         };
 
         /**
          * @brief Iterator of a node.
          * @author Eduardo Sarmento & Victor Vieira
-         * 
+         *
          * Encapsulates a pointer to a node.
          */
-        class iterator
+        class iterator : private stats_ref<Stats>
         {
         public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
             /// Default constructor that creates an nullptr.
             iterator() : current(nullptr) {}
 
             /// Return a const reference to the object located at the position pointed by the iterator.
-            const T &operator*() const { return current->data; } // *it
+            const T &operator*() const { return static_cast<Node *>(current)->data(); } // *it
 
             /// Return a reference to the object located at the position pointed by the iterator.
-            T &operator*() { return current->data; }
+            T &operator*() { return static_cast<Node *>(current)->data(); }
 
             /// Advances the iterator to the next location within the list and returns itself after that.
-            iterator operator++()
+            iterator &operator++()
             { // ++it
                 current = current->next;
-                return iterator(current);
+                return *this;
             }
 
             /// Advances the iterator to the next location within the list and returns itself before that.
             iterator operator++(int n)
             {
-                iterator temp(current);
+                iterator temp(*this);
                 current = current->next;
                 return temp;
             }
@@ -129,12 +204,7 @@ namespace sc
             /// Advances to the n-th successor node of the iterator and returns it.
             friend iterator operator+(int n, iterator it)
             {
-                for (int i = 0; i < n; i++)
-                {
-                    it.current = it.current->next;
-                }
-
-                return it.current;
+                return it + n;
             }
 
             friend iterator operator+(iterator it, int n)
@@ -144,36 +214,34 @@ namespace sc
                     it.current = it.current->next;
                 }
 
-                return it.current;
+                it.hops(list_op::advance, n < 0 ? 0 : n);
+                return it;
             }
 
             /// Backs the iterator to the previous location within the list and returns itself after that.
-            iterator operator--() // --it
+            iterator &operator--() // --it
             {
                 current = current->prev;
-                return iterator(current);
+                return *this;
             }
 
             /// Backs the iterator to the previous location within the list and returns itself before that.
             iterator operator--(int n) // it--
             {
-                iterator temp(current);
+                iterator temp(*this);
                 current = current->prev;
                 return temp;
             }
 
             /// Returns the distance between the nodes (not between the adresses).
-            size_type operator-(iterator rhs)
+            size_type operator-(iterator rhs) const
             {
                 size_type dis = 0;
-                iterator cur(current);
 
-                while (rhs != cur)
-                {
+                for (NodeBase *n = rhs.current; n != current; n = n->next)
                     dis++;
-                    rhs++;
-                }
 
+                this->hops(list_op::distance, dis);
                 return dis;
             }
 
@@ -189,136 +257,85 @@ namespace sc
                 return current != rhs.current;
             }
 
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current); }
+
         protected:
-            Node *current;                    //<! The pointer to the node data.
-            iterator(Node *p) : current(p) {} //<! Constructor that receives a pointer.
-            friend class list<T>;             //<! List can access members of iterator.;
+            NodeBase *current;                                                              //<! The pointer to the node data.
+            iterator(NodeBase *p, Stats *s = nullptr) : stats_ref<Stats>(s), current(p) {} //<! Constructor that receives a pointer and the stats to record to.
+            friend class list;                                                              //<! List can access members of iterator.
         };
 
     public:
         /// Default constructor that creates an empty list.
-        list() : SIZE{0}, head{new Node}, tail{new Node}
+        list() : list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its nodes from alloc.
+        explicit list(const Alloc &a) : SIZE{0}, alloc{a}, compact_from{nullptr}, spare{nullptr}, spares{0}, reserved{0}
         {
-            head->prev = nullptr;
-            head->next = tail;
-            tail->prev = head;
-            tail->next = nullptr;
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
         }
 
         /// Constructs the list with count default-inserted instances of T.
-        explicit list(size_type count) : SIZE{count}, head{new Node}, tail{new Node}
+        explicit list(size_type count, const Alloc &a = Alloc()) : list(a)
         {
-            head->prev = nullptr;
-            tail->next = nullptr;
-
-            if (SIZE > 0)
-            {
-                Node *prevNode = head;
-
-                for (size_type i = 0; i < SIZE; i++)
-                {
-                    Node *newNode = new Node;
-                    prevNode->next = newNode;
-                    newNode->prev = prevNode;
-                    prevNode = newNode;
-                }
-
-                prevNode->next = tail;
-            }
-            else
-            {
-                head->next = tail;
-                tail->prev = head;
-            }
+            append_block(count, [this](T *slot) { node_traits::construct(alloc, slot); });
         }
 
         /// Constructs the list with the contents of the range [first, last).
         template <typename InputIt>
-        list(InputIt first, InputIt last) : SIZE{last - first}, head{new Node}, tail{new Node}
+        list(InputIt first, InputIt last, const Alloc &a = Alloc()) : list(a)
         {
-            head->prev = nullptr;
-            tail->next = nullptr;
-            head->next = tail;
-            tail->prev = head;
-
-            Node *curNode = head;
-
-            while (first != last)
+            if constexpr (is_forward<InputIt>::value)
             {
-                Node *newNode = new Node;
-                curNode->next = newNode;
-                newNode->prev = curNode;
-                curNode = curNode->next;
-                newNode->data = *(first++);
-                newNode->next = tail;
-                tail->prev = newNode;
+                size_type count = 0;
+                for (InputIt it = first; it != last; ++it)
+                    count++;
+
+                append_block(count, [this, &first](T *slot) {
+                    node_traits::construct(alloc, slot, *first);
+                    ++first;
+                });
+            }
+            else
+            {
+                while (first != last)
+                    emplace_back(*(first++));
             }
         }
 
         /// Copy constructor. Constructs the list with the deep copy of the contents of other.
-        list(const list &other) : SIZE{other.size()}, head{new Node}, tail{new Node}
+        list(const list &other) : list(Alloc(node_traits::select_on_container_copy_construction(other.alloc)))
         {
-            head->prev = nullptr;
-            tail->next = nullptr;
-            head->next = tail;
-            tail->prev = head;
-
-            Node *cp = other.head->next;
-            Node *curNode = head;
-
-            for (size_type i = 0; i < SIZE; i++)
-            {
-                Node *newNode = new Node;
-                curNode->next = newNode;
-                newNode->prev = curNode;
-                curNode = curNode->next;
-                newNode->data = cp->data;
-                newNode->next = tail;
-                tail->prev = newNode;
+            const NodeBase *cp = other.sentinel.next;
 
+            append_block(other.SIZE, [this, &cp](T *slot) {
+                node_traits::construct(alloc, slot, node(cp)->data());
                 cp = cp->next;
-            }
+            });
         }
 
-        /// Constructs the list with the contents of the initializer list init.
-        list(std::initializer_list<T> ilist) : SIZE{ilist.size()}, head{new Node}, tail{new Node}
+        /// Move constructor. Takes over the nodes of other in O(1), leaving other empty.
+        list(list &&other) noexcept : list(Alloc(other.alloc))
         {
-            head->prev = nullptr;
-            tail->next = nullptr;
-            if (SIZE > 0)
-            {
-                Node *prevNode = head;
-
-                for (size_type i = 0; i < SIZE; i++)
-                {
-                    Node *newNode = new Node;
-                    prevNode->next = newNode;
-                    newNode->data = *(ilist.begin() + i);
-                    newNode->prev = prevNode;
-                    prevNode = newNode;
-                }
-
-                prevNode->next = tail;
-                tail->prev = prevNode;
-            }
-            else
-            {
-                head->next = tail;
-                tail->prev = head;
-            }
+            take_nodes(other);
         }
 
+        /// Constructs the list with the contents of the initializer list init.
+        list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : list(ilist.begin(), ilist.end(), a) {}
+
         /// Destructor
         ~list()
         {
-            Node *curNode = head;
+            clear();
+            shrink_to_fit();
+        }
 
-            while (curNode != nullptr)
-            {
-                Node *nxt = curNode->next;
-                delete curNode;
-                curNode = nxt;            
-            }
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
         }
 
         // [II ITERATORS]
@@ -326,25 +343,48 @@ namespace sc
         /// Returns an iterator pointing to the first item in the list.
         iterator begin()
         {
-            return iterator(head->next);
+            return iterator(sentinel.next, this);
         }
 
         /// Returns an iterator pointing to the end mark in the list, i.e. the position just after the last element of the list.
         iterator end()
         {
-            return iterator(tail);
+            return iterator(&sentinel, this);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
         }
 
         /// Returns a constant iterator pointing to the first item in the list.
-        const_iterator cbegin()
+        const_iterator cbegin() const
         {
-            return const_iterator(head->next);
+            return const_iterator(sentinel.next);
         }
 
         /// Returns a constant iterator pointing to the end mark in the list, i.e. the position just after the last element of the list.
-        const_iterator cend()
+        const_iterator cend() const
         {
-            return const_iterator(tail);
+            return const_iterator(const_cast<NodeBase *>(&sentinel));
+        }
+
+        /// Returns the instrumentation policy, which holds what has been recorded so far.
+        const Stats &stats() const
+        {
+            return *this;
+        }
+
+        Stats &stats()
+        {
+            return *this;
         }
 
         // [III] CAPACITY
@@ -356,27 +396,58 @@ namespace sc
         }
 
         /// Returns true if the container contains no elements, and false otherwise.
-        bool empty()
+        bool empty() const
         {
             return SIZE == 0;
         }
 
+        /// Returns the number of elements the list can hold without calling the allocator: its size plus its spare nodes.
+        size_type capacity() const
+        {
+            return SIZE + spares;
+        }
+
+        /// Allocates, as one block, the spare nodes the list needs to hold count elements, and keeps up to count spare nodes from now on.
+        void reserve(size_type count)
+        {
+            reserved = std::max(reserved, count);
+
+            if (count <= SIZE + spares)
+                return;
+
+            Block *b = allocate_block(count - SIZE - spares, [](T *) {});
+
+            Node *first = first_node(b);
+            for (size_type i = b->count; i > 0; i--)
+                push_spare(&first[i - 1]);
+        }
+
+        /// Gives the spare nodes back to the allocator and stops keeping them, so the list only holds the nodes of its elements.
+        void shrink_to_fit()
+        {
+            reserved = 0;
+
+            while (spare != nullptr)
+                free_node(pop_spare());
+        }
+
         // [IV] MODIFIERS
 
         /// Remove all elements from the container.
         void clear()
         {
-            Node *curNode = head->next;
+            NodeBase *curNode = sentinel.next;
 
-            while (curNode->next != nullptr)
+            while (curNode != &sentinel)
             {
-                Node *nxt = curNode->next;
-                delete curNode;
+                NodeBase *nxt = curNode->next;
+                destroy_node(node(curNode));
                 curNode = nxt;
             }
 
-            head->next = tail;
-            tail->prev = head;
+            sentinel.next = &sentinel;
+            sentinel.prev = &sentinel;
+            compact_from = nullptr;
 
             SIZE = 0;
         }
@@ -384,129 +455,141 @@ namespace sc
         /// Returns the object at the front of the list.
         T &front()
         {
-            return head->next->data;
+            return node(sentinel.next)->data();
         }
 
         /// Returns the object at the front of the list.
         const T &front() const
         {
-            return head->next->data;
+            return node(sentinel.next)->data();
         }
 
         /// Returns the object at the end of the list.
         const T &back()
         {
-            return tail->prev->data;
+            return node(sentinel.prev)->data();
         }
 
         /// Returns the object at the end of the list.
         const T &back() const
         {
-            return tail->prev->data;
+            return node(sentinel.prev)->data();
         }
 
         /// Adds value to the front of the list.
         void push_front(const T &value)
         {
-            SIZE += 1;
-            Node *curNode = head->next;
-            Node *newNode = new Node;
+            emplace_front(value);
+        }
 
-            curNode->prev = newNode;
-            newNode->next = curNode;
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace_front(std::move(value));
+        }
 
-            curNode = curNode->prev;
-            newNode->data = value;
-            newNode->prev = head;
-            head->next = newNode;
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return link_before(sentinel.next, create_node(std::forward<Args>(args)...))->data();
         }
 
         /// Adds value to the back of the list.
         void push_back(const T &value)
         {
-            SIZE += 1;
-            Node *curNode = tail->prev;
-            Node *newNode = new Node;
+            emplace_back(value);
+        }
 
-            curNode->next = newNode;
-            newNode->prev = curNode;
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace_back(std::move(value));
+        }
 
-            curNode = curNode->next;
-            newNode->data = value;
-            newNode->next = tail;
-            tail->prev = newNode;
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return link_before(&sentinel, create_node(std::forward<Args>(args)...))->data();
         }
 
         /// Removes value of the front of the list.
         void pop_front()
         {
             SIZE--;
-            Node *popped = head->next;
-            std::cout << "Popping " << popped->data << std::endl;
-            head->next = popped->next;
-            popped->next->prev = head;
-            delete popped;
+            NodeBase *popped = sentinel.next;
+            sentinel.next = popped->next;
+            popped->next->prev = &sentinel;
+            destroy_node(node(popped));
+            stats().on_hops(list_op::erase, 0);
         }
 
         /// Removes value of the back of the list.
         void pop_back()
         {
             SIZE -= 1;
-            Node *popped = tail->prev;
-            tail->prev = popped->prev;
-            popped->prev->next = tail;
-            delete popped;
+            NodeBase *popped = sentinel.prev;
+            sentinel.prev = popped->prev;
+            popped->prev->next = &sentinel;
+            destroy_node(node(popped));
+            stats().on_hops(list_op::erase, 0);
         }
 
         /// Replaces the content of the list with copies of value value.
         void assign(const T &value) {
-            Node *curNode = head->next;
-
-            while (curNode != tail) {
-                curNode->data = value;
-                curNode = curNode->next;
-            }
+            traversal::for_each(&sentinel, SIZE, value_of, [&value](T &e) { e = value; });
         }
 
-        /// Replaces the contents with count copies of value value.
+        /// Replaces the contents with count copies of value value, reusing the nodes the list already has.
         void assign( size_type count, const T& value ) {
-            clear();
-            Node *curNode = head;
-            SIZE = count;
+            NodeBase *curNode = sentinel.next;
+            for (; curNode != &sentinel && count > 0; curNode = curNode->next, count--)
+                node(curNode)->data() = value;
 
-            for (size_type i = 0; i < count; i++) {
-                Node *newNode = new Node;
-                
-                newNode->data = value;
-                newNode->prev = curNode;
-                newNode->next = tail;
+            erase(iterator(curNode, this), end());
 
-                curNode->next = newNode;
-                tail->prev = newNode;
+            for (; count > 0 && spare != nullptr; count--)
+                emplace_back(value);
+            append_block(count, [this, &value](T *slot) { node_traits::construct(alloc, slot, value); });
+        }
 
-                curNode = curNode->next;
-            }
+        /// Copy the size and values from another list, reusing the nodes this list already has.
+        list &operator=(const list &other)
+        {
+            if (this == &other)
+                return *this;
+
+            assign_range(other.cbegin(), other.cend());
+
+            return *this;
         }
 
-        /// Copy the size and values from another list.
-        list &operator=(list other)
+        /// Takes over the nodes of other, leaving it empty. O(1) unless the allocators differ and do not propagate.
+        list &operator=(list &&other) noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value)
         {
-            clear();
-            iterator cpy(other.begin());
-            Node *curNode = head;
+            if (this == &other)
+                return *this;
 
-            for (size_type i = 0; i < other.size(); i++) {
-                Node *newNode = new Node;
-                
-                newNode->data = *(cpy++);
-                newNode->prev = curNode;
-                newNode->next = tail;
+            // The spare nodes of this list came from its own allocator.
+            clear();
+            shrink_to_fit();
 
-                curNode->next = newNode;
-                tail->prev = newNode;
+            if (node_traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = other.alloc;
+                take_nodes(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                take_nodes(other);
+            }
+            else
+            {
+                for (NodeBase *curNode = other.sentinel.next; curNode != &other.sentinel; curNode = curNode->next)
+                    emplace_back(std::move(node(curNode)->data()));
 
-                curNode = curNode->next;
-                SIZE++;
+                other.clear();
             }
 
             return *this;
@@ -523,184 +606,896 @@ namespace sc
         /// Returns true if each element of a list is equal to another.
         friend bool operator==(const list &lhs, const list &rhs)
         {
-            bool isEqual = lhs.SIZE == rhs.SIZE;
+            return lhs.SIZE == rhs.SIZE && traversal::equal(&lhs.sentinel, &rhs.sentinel, lhs.SIZE, value_of, std::equal_to<>());
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const list &lhs, const list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /// Compares the elements of two lists in lexicographical order.
+        friend bool operator<(const list &lhs, const list &rhs)
+        {
+            return traversal::lexicographical_compare(&lhs.sentinel, lhs.SIZE, &rhs.sentinel, rhs.SIZE, value_of, std::less<>());
+        }
+
+        friend bool operator>(const list &lhs, const list &rhs) { return rhs < lhs; }
+        friend bool operator<=(const list &lhs, const list &rhs) { return !(rhs < lhs); }
+        friend bool operator>=(const list &lhs, const list &rhs) { return !(lhs < rhs); }
+
+        // [IV-a] Modifiers with iterators
+
+        /// Replaces the contents of the list with the elements from the initializer list ilist, reusing the nodes the list already has.
+        void assign(std::initializer_list<T> ilist) {
+            assign_range(ilist.begin(), ilist.end());
+        }
+
+        /// Adds value into the list before the position given by the iterator pos and returns an iterator to the position of the inserted item.
+        iterator insert(iterator itr, const T &value)
+        {
+            return emplace(itr, value);
+        }
+
+        /// Moves value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator itr, T &&value)
+        {
+            return emplace(itr, std::move(value));
+        }
+
+        /// Constructs an element in place before pos and returns an iterator to it.
+        template <typename... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            return iterator(link_before(pos.current, create_node(std::forward<Args>(args)...)), this);
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            NodeBase *head, *tail;
+            size_type count = build_chain(first, last, head, tail);
+
+            if (count == 0)
+                return pos;
+
+            return iterator(link_chain(pos.current, head, tail, count), this);
+        }
+
+        /// Inserts the elements of rg before pos, linking them in one step, and returns an iterator to the first inserted item.
+        template <typename Range>
+        iterator insert_range(iterator pos, Range &&rg)
+        {
+            using std::begin;
+            using std::end;
+            return insert(pos, begin(rg), end(rg));
+        }
+
+        /// Adds the elements of rg to the back of the list.
+        template <typename Range>
+        void append_range(Range &&rg)
+        {
+            insert_range(end(), std::forward<Range>(rg));
+        }
+
+        /// Adds the elements of rg, in order, to the front of the list.
+        template <typename Range>
+        void prepend_range(Range &&rg)
+        {
+            insert_range(begin(), std::forward<Range>(rg));
+        }
+
+        /// Inserts elements from the initializer list ilist before pos and returns an iterator to the first inserted item.
+        iterator insert(iterator pos, std::initializer_list<T> ilist) {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos) {
+            NodeBase *delNode = pos.current;
+            NodeBase *nextNode = delNode->next;
+
+            delNode->prev->next = nextNode;
+            nextNode->prev = delNode->prev;
+            destroy_node(node(delNode));
+            SIZE--;
+            stats().on_hops(list_op::erase, 0);
+
+            return iterator(nextNode, this);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last) {
+            NodeBase *prevNode = first.current->prev;
+            NodeBase *curNode = first.current;
+            size_type hops = 0;
+
+            prevNode->next = last.current;
+            last.current->prev = prevNode;
+
+            while (curNode != last.current) {
+                NodeBase *nxt = curNode->next;
+                destroy_node(node(curNode));
+                curNode = nxt;
+                SIZE--;
+                hops++;
+            }
+
+            stats().on_hops(list_op::erase, hops);
+            return iterator(last.current, this);
+        }
+
+        // [V] OPERATIONS
+        // They only relink existing nodes: nothing is allocated, copied or moved.
 
-            if (isEqual) {
-                Node *curNodeL = lhs.head->next;
-                Node *curNodeR = rhs.head->next;
-                for (size_type i = 0; i < rhs.SIZE; i++)
+        /// Moves every element of other before pos in O(1). other must use an equal allocator.
+        void splice(iterator pos, list &other)
+        {
+            splice_counted(pos, other, other.begin(), other.end(), other.SIZE);
+        }
+
+        void splice(iterator pos, list &&other)
+        {
+            splice(pos, other);
+        }
+
+        /// Moves the element at it from other to the position before pos in O(1).
+        void splice(iterator pos, list &other, iterator it)
+        {
+            iterator last(it.current->next);
+            splice_counted(pos, other, it, last, 1);
+        }
+
+        /// Moves the elements [first, last) from other before pos. O(1) within the same list, otherwise the range is counted.
+        void splice(iterator pos, list &other, iterator first, iterator last)
+        {
+            size_type count = 0;
+            if (&other != this)
+            {
+                for (NodeBase *n = first.current; n != last.current; n = n->next)
+                    count++;
+                stats().on_hops(list_op::splice, count);
+            }
+
+            splice_counted(pos, other, first, last, count);
+        }
+
+        /// Merges the sorted list other into this sorted list. The merge is stable and other is left empty.
+        template <typename Compare = std::less<>>
+        void merge(list &other, Compare comp = Compare())
+        {
+            if (&other == this)
+                return;
+
+            NodeBase *curNode = sentinel.next;
+            NodeBase *otherNode = other.sentinel.next;
+            other.compact_from = nullptr; // It may be one of the nodes that leave
+
+            // Sizes follow every node moved, so both lists stay consistent if comp throws.
+            while (curNode != &sentinel && otherNode != &other.sentinel)
+            {
+                if (comp(node(otherNode)->data(), node(curNode)->data()))
                 {
-                    if (curNodeL->data != curNodeR->data)
-                        return false;
+                    NodeBase *nxt = otherNode->next;
+                    transfer(curNode, otherNode, nxt);
+                    otherNode = nxt;
+                    other.SIZE--;
+                    SIZE++;
+                }
+                else
+                {
+                    curNode = curNode->next;
+                }
+            }
 
-                    curNodeL = curNodeL->next;
-                    curNodeR = curNodeR->next;
-                }    
-            }    
+            if (otherNode != &other.sentinel)
+                transfer(&sentinel, otherNode, &other.sentinel);
 
-            return isEqual;
+            SIZE += other.SIZE;
+            other.SIZE = 0;
+            stats().on_grow(SIZE);
         }
 
-        /// Returns true if, at least, one element of a list is different to another.
-        friend bool operator!=(const list &lhs, const list &rhs)
+        template <typename Compare = std::less<>>
+        void merge(list &&other, Compare comp = Compare())
         {
-            bool isDifferent = lhs.SIZE != rhs.SIZE;
-            if (!isDifferent)
+            merge(other, comp);
+        }
+
+        /// Sorts the list with a stable bottom-up natural merge sort that uses O(1) extra memory.
+        template <typename Compare = std::less<>>
+        void sort(Compare comp = Compare())
+        {
+            if (SIZE < 2)
+                return;
+
+            // Work on null-terminated chains, only next links are kept up to date while merging.
+            // Every node is always in one of merged, left, right or first, so that if comp throws
+            // they can be linked back into the ring, in an unspecified order.
+            NodeBase *first = sentinel.next;
+            sentinel.prev->next = nullptr;
+            NodeBase *merged = nullptr;
+            NodeBase **tail = &merged;
+            NodeBase *left = nullptr;
+            NodeBase *right = nullptr;
+
+            try
+            {
+                for (;;)
+                {
+                    merged = nullptr;
+                    tail = &merged;
+                    size_type runs = 0;
+
+                    while (first != nullptr)
+                    {
+                        left = first;
+                        first = nullptr;
+                        right = cut_run(left, comp);
+                        runs++;
+
+                        if (right == nullptr)
+                        {
+                            *tail = left;
+                            left = nullptr;
+                            break;
+                        }
+
+                        first = cut_run(right, comp);
+                        merge_chains(left, right, tail, comp);
+                    }
+
+                    first = merged;
+                    merged = nullptr;
+                    tail = &merged;
+                    if (runs == 1)
+                        break;
+                }
+            }
+            catch (...)
+            {
+                // The link at tail may still point into left or right.
+                *tail = nullptr;
+                NodeBase *chains[] = {merged, left, right, first};
+                NodeBase *all = nullptr;
+                NodeBase **end = &all;
+                for (NodeBase *chain : chains)
+                {
+                    *end = chain;
+                    while (*end != nullptr)
+                        end = &(*end)->next;
+                }
+
+                close_ring(all);
+                throw;
+            }
+
+            close_ring(first);
+        }
+
+        /// Removes every element equal to value and returns how many were removed.
+        size_type remove(const T &value)
+        {
+            return remove_if([&value](const T &e) { return e == value; });
+        }
+
+        /// Removes every element for which pred returns true and returns how many were removed.
+        template <typename UnaryPredicate>
+        size_type remove_if(UnaryPredicate pred)
+        {
+            NodeBase *removed = nullptr;
+            NodeBase *curNode = sentinel.next;
+
+            try
             {
-                Node *curNodeL = lhs.head->next;
-                Node *curNodeR = rhs.head->next;
-                for (size_type i = 0; i < lhs.SIZE; i++)
+                while (curNode != &sentinel)
                 {
-                    if (curNodeL->data != curNodeR->data)
-                        return true;
+                    NodeBase *nxt = curNode->next;
 
-                    curNodeL = curNodeL->next;
-                    curNodeR = curNodeR->next;
+                    if (pred(node(curNode)->data()))
+                        removed = unlink_into(curNode, removed);
+
+                    curNode = nxt;
                 }
+            }
+            catch (...)
+            {
+                destroy_removed(removed);
+                throw;
+            }
+
+            return destroy_removed(removed);
+        }
 
-                return false;
+        /// Removes consecutive duplicate elements and returns how many were removed.
+        template <typename BinaryPredicate = std::equal_to<>>
+        size_type unique(BinaryPredicate pred = BinaryPredicate())
+        {
+            NodeBase *removed = nullptr;
+
+            if (SIZE < 2)
+                return 0;
+
+            NodeBase *keep = sentinel.next;
+            NodeBase *curNode = keep->next;
+
+            try
+            {
+                while (curNode != &sentinel)
+                {
+                    NodeBase *nxt = curNode->next;
+
+                    if (pred(node(keep)->data(), node(curNode)->data()))
+                        removed = unlink_into(curNode, removed);
+                    else
+                        keep = curNode;
+
+                    curNode = nxt;
+                }
+            }
+            catch (...)
+            {
+                destroy_removed(removed);
+                throw;
             }
 
-            return isDifferent;
+            return destroy_removed(removed);
         }
 
-        // [IV-a] Modifiers with iterators
-        
-        /// Replaces the contents of the list with the elements from the initializer list ilist.
-        void assign(std::initializer_list<T> ilist) {
-            clear();
-            SIZE = ilist.size();
-            Node *prevNode = head;
+        /// Reverses the order of the elements by swapping the links of every node.
+        void reverse()
+        {
+            NodeBase *curNode = &sentinel;
 
-            for (size_type i = 0; i < SIZE; i++)
+            do
             {
-                Node *newNode = new Node;
-                prevNode->next = newNode;
-                newNode->data = *(ilist.begin() + i);
-                newNode->prev = prevNode;
-                prevNode = newNode;
+                std::swap(curNode->prev, curNode->next);
+                curNode = curNode->prev;
+            } while (curNode != &sentinel);
+        }
+
+        /// Returns an iterator to the first element equal to value, or end() if there is none. Linear; see sc::indexed_list for O(1) lookups.
+        iterator find(const T &value)
+        {
+            // Comparing with == has no visible order, so both ends are walked at once.
+            return iterator(traversal::find_if(&sentinel, SIZE, value_of, [&value](const T &e) { return e == value; }), this);
+        }
+
+        const_iterator find(const T &value) const
+        {
+            return const_iterator(const_cast<NodeBase *>(traversal::find_if(&sentinel, SIZE, value_of, [&value](const T &e) { return e == value; })));
+        }
+
+        /// Returns an iterator to the first element for which pred is true, or end(). pred is called front to back and never after the first match.
+        template <typename UnaryPredicate>
+        iterator find_if(UnaryPredicate pred)
+        {
+            return iterator(traversal::find_first_if(&sentinel, value_of, pred), this);
+        }
+
+        template <typename UnaryPredicate>
+        const_iterator find_if(UnaryPredicate pred) const
+        {
+            return const_iterator(const_cast<NodeBase *>(traversal::find_first_if(&sentinel, value_of, pred)));
+        }
+
+        /// Returns the number of elements equal to value.
+        size_type count(const T &value) const
+        {
+            return traversal::count_if(&sentinel, SIZE, value_of, [&value](const T &e) { return e == value; });
+        }
+
+        // [VI] MEMORY LAYOUT
+
+        /**
+         * Returns the share, from 0 to 1, of consecutive elements whose nodes are close in memory: the
+         * next node starts after the current one and at most a cache line past its end. A list built
+         * by one constructor, or compacted, scores 1; after long insert/erase churn the nodes are
+         * scattered over the heap, the score tends to 0 and every step of a traversal misses the cache.
+         */
+        double locality() const
+        {
+            constexpr std::uintptr_t cache_line = 64;
+
+            if (SIZE < 2)
+                return 1.0;
+
+            size_type close = 0;
+            for (const NodeBase *curNode = sentinel.next; curNode->next != &sentinel; curNode = curNode->next)
+            {
+                std::uintptr_t here = reinterpret_cast<std::uintptr_t>(curNode);
+                std::uintptr_t there = reinterpret_cast<std::uintptr_t>(curNode->next);
+                if (there > here && there - here <= sizeof(Node) + cache_line)
+                    close++;
             }
 
-            prevNode->next = tail;
-            tail->prev = prevNode;
+            return static_cast<double>(close) / static_cast<double>(SIZE - 1);
         }
 
-        /// Adds value into the list before the position given by the iterator pos and returns an iterator to the position of the inserted item.
-        iterator insert(iterator itr, const T &value)
+        /// Moves every element, in list order, to the nodes of one new block and frees the old nodes. Invalidates iterators, pointers and references.
+        void compact()
+        {
+            compact_from = nullptr;
+            compact(SIZE);
+        }
+
+        /**
+         * Compacts the list a step at a time, so it can run from an idle loop. Each call looks at the
+         * next budget nodes, from where the previous call stopped, and moves their elements to a new
+         * block unless the nodes already follow each other in memory. Returns true when the step
+         * reached the end of the list; the next call starts over from the front.
+         *
+         * The list may change between calls. If the node a step would resume from is erased or
+         * spliced away, the next step starts from the front. Iterators, pointers and references to
+         * the moved elements are invalidated. If moving an element throws, the list is unchanged.
+         */
+        bool compact(size_type budget)
         {
+            NodeBase *first = compact_from != nullptr ? compact_from : sentinel.next;
+            NodeBase *last = first;
+            size_type count = 0;
+            bool contiguous = true;
+
+            for (; count < budget && last != &sentinel; count++, last = last->next)
+            {
+                if (count > 0 && reinterpret_cast<std::uintptr_t>(last) != reinterpret_cast<std::uintptr_t>(last->prev) + sizeof(Node))
+                    contiguous = false;
+            }
+
+            if (!contiguous)
+                relocate(first, count);
+
+            compact_from = last == &sentinel ? nullptr : last;
+            return last == &sentinel;
+        }
+
+    private:
+        /// Downcasts a link to the node that holds it. Must not be called on the sentinel.
+        static Node *node(NodeBase *link)
+        {
+            return static_cast<Node *>(link);
+        }
+
+        static const Node *node(const NodeBase *link)
+        {
+            return static_cast<const Node *>(link);
+        }
+
+        /// Element of a node, for the traversal kernels.
+        struct value_accessor
+        {
+            T &operator()(NodeBase *link) const { return node(link)->data(); }
+            const T &operator()(const NodeBase *link) const { return node(link)->data(); }
+        };
+
+        static constexpr value_accessor value_of{};
+
+        /// Allocates a node through the node allocator and constructs its data from args.
+        template <typename... Args>
+        Node *create_node(Args &&...args)
+        {
+            if (spare != nullptr)
+            {
+                Node *newNode = pop_spare();
+                try
+                {
+                    node_traits::construct(alloc, newNode->data_ptr(), std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    push_spare(newNode);
+                    throw;
+                }
+
+                return newNode;
+            }
+
+            Node *newNode = node_traits::allocate(alloc, 1);
+            stats().on_allocate();
+            newNode->block = nullptr;
+
+            try
+            {
+                node_traits::construct(alloc, newNode->data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc, newNode, 1);
+                stats().on_deallocate();
+                throw;
+            }
+
+            return newNode;
+        }
+
+        /// Overwrites the elements with those of the forward range [first, last), then erases or adds nodes for the difference.
+        template <typename ForwardIt>
+        void assign_range(ForwardIt first, ForwardIt last)
+        {
+            NodeBase *curNode = sentinel.next;
+            for (; curNode != &sentinel && first != last; curNode = curNode->next, ++first)
+                node(curNode)->data() = *first;
+
+            erase(iterator(curNode, this), end());
+
+            // Spare nodes first, then one block for the rest.
+            for (; first != last && spare != nullptr; ++first)
+                emplace_back(*first);
+
+            size_type count = 0;
+            for (ForwardIt it = first; it != last; ++it)
+                count++;
+            append_block(count, [this, &first](T *slot) {
+                node_traits::construct(alloc, slot, *first);
+                ++first;
+            });
+        }
+
+        /// Moves the count elements [first, last) from other before pos in O(1). count must be the length of the range.
+        void splice_counted(iterator pos, list &other, iterator first, iterator last, size_type count)
+        {
+            if (first == last || pos == first || pos == last)
+                return;
+
+            if (&other != this)
+            {
+                other.compact_from = nullptr; // It may be one of the nodes that leave
+                other.SIZE -= count;
+                SIZE += count;
+                stats().on_grow(SIZE);
+            }
+
+            transfer(pos.current, first.current, last.current);
+        }
+
+        /// Links node right before pos and accounts for it in the size.
+        Node *link_before(NodeBase *pos, Node *newNode)
+        {
+            newNode->prev = pos->prev;
+            newNode->next = pos;
+            pos->prev->next = newNode;
+            pos->prev = newNode;
             SIZE += 1;
-            iterator first(begin());
+            stats().on_grow(SIZE);
+            stats().on_hops(list_op::insert, 0);
+
+            return newNode;
+        }
+
+        /// Builds a chain [head, tail] with the elements of [first, last) and returns its length. Frees it all on an exception.
+        template <typename InputIt>
+        size_type build_chain(InputIt first, InputIt last, NodeBase *&head, NodeBase *&tail)
+        {
+            size_type count = 0;
+            head = tail = nullptr;
 
-            Node *curNode = head->next;
-            while (first != itr)
+            try
             {
-                curNode = curNode->next;
-                first++;
+                for (; first != last; ++first, ++count)
+                {
+                    Node *newNode = create_node(*first);
+                    newNode->prev = tail;
+
+                    if (tail == nullptr)
+                        head = newNode;
+                    else
+                        tail->next = newNode;
+                    tail = newNode;
+                }
+            }
+            catch (...)
+            {
+                while (head != nullptr)
+                {
+                    NodeBase *nxt = head == tail ? nullptr : head->next;
+                    destroy_node(node(head));
+                    head = nxt;
+                }
+                throw;
             }
 
-            Node *newNode = new Node;
-            Node *prevNode = curNode->prev;
+            return count;
+        }
 
-            curNode->prev = newNode;
-            newNode->next = curNode;
-            curNode = curNode->prev;
-            newNode->data = value;
-            newNode->prev = prevNode;
-            prevNode->next = newNode;
+        /// Links the chain [head, tail] of count nodes before pos with four pointer writes and returns head.
+        NodeBase *link_chain(NodeBase *pos, NodeBase *head, NodeBase *tail, size_type count)
+        {
+            head->prev = pos->prev;
+            tail->next = pos;
+            pos->prev->next = head;
+            pos->prev = tail;
+            SIZE += count;
+            stats().on_grow(SIZE);
+            stats().on_hops(list_op::insert, 0);
+
+            return head;
+        }
 
-            return iterator(newNode);
+        /// Moves the nodes [first, last) before pos. Sizes are not touched.
+        static void transfer(NodeBase *pos, NodeBase *first, NodeBase *last)
+        {
+            NodeBase *lastNode = last->prev;
+
+            // Unlink [first, lastNode] from where it is...
+            first->prev->next = last;
+            last->prev = first->prev;
+
+            // ... and link it before pos.
+            first->prev = pos->prev;
+            lastNode->next = pos;
+            pos->prev->next = first;
+            pos->prev = lastNode;
         }
 
-        /// Inserts elements from the range [first; last) before pos.
-        template <class InItr>
-        iterator insert(iterator pos, InItr first, InItr last)
+        /// Cuts the non-descending run that starts at first out of a null-terminated chain and returns what follows it.
+        template <typename Compare>
+        static NodeBase *cut_run(NodeBase *first, Compare &comp)
         {
-            const size_type cpySize = last - first;        
-            --last;
+            NodeBase *last = first;
 
-            for (size_type i = 0; i < cpySize; i++, last--) {
-                T vl = *(last);
-                pos = insert(pos, vl);
-            } 
+            while (last->next != nullptr && !comp(node(last->next)->data(), node(last)->data()))
+                last = last->next;
 
-            return pos;
+            NodeBase *rest = last->next;
+            last->next = nullptr;
+            return rest;
         }
 
-        /// Inserts elements from the initializer list ilist before pos.
-        iterator insert(iterator pos, std::initializer_list<T> ilist) {
-            SIZE += ilist.size();
-            iterator start(begin());
+        /// Links the null-terminated chain starting at first as the whole content of the list, restoring the prev links.
+        void close_ring(NodeBase *first)
+        {
+            NodeBase *prevNode = &sentinel;
+            for (NodeBase *curNode = first; curNode != nullptr; curNode = curNode->next)
+            {
+                curNode->prev = prevNode;
+                prevNode->next = curNode;
+                prevNode = curNode;
+            }
+
+            prevNode->next = &sentinel;
+            sentinel.prev = prevNode;
+        }
+
+        /**
+         * Stable merge of two null-terminated runs appended at *tail. left, right and tail follow
+         * every node taken, so the caller can recover the chains if comp throws; once the merge is
+         * done left and right are null and tail is the next link of the last merged node.
+         */
+        template <typename Compare>
+        static void merge_chains(NodeBase *&left, NodeBase *&right, NodeBase **&tail, Compare &comp)
+        {
+            while (left != nullptr && right != nullptr)
+            {
+                if (comp(node(right)->data(), node(left)->data()))
+                {
+                    *tail = right;
+                    right = right->next;
+                }
+                else
+                {
+                    *tail = left;
+                    left = left->next;
+                }
+
+                tail = &(*tail)->next;
+            }
 
-            Node *curNode = head->next;
-            while (start != pos)
+            *tail = left != nullptr ? left : right;
+            left = right = nullptr;
+            while (*tail != nullptr)
+                tail = &(*tail)->next;
+        }
+
+        /// Moves every node of other, spare ones too, to this list, which must have none, and leaves other empty.
+        void take_nodes(list &other)
+        {
+            if (other.SIZE == 0 && other.spare == nullptr)
+                return;
+
+            if (other.SIZE != 0)
             {
-                curNode = curNode->next;
-                start++;
+                sentinel.next = other.sentinel.next;
+                sentinel.prev = other.sentinel.prev;
+                sentinel.next->prev = &sentinel;
+                sentinel.prev->next = &sentinel;
+                SIZE = other.SIZE;
+                stats().on_grow(SIZE);
             }
 
-            for (size_type i = 1; i <= ilist.size(); i++) {
-                Node *newNode = new Node;
-                
-                newNode->prev = curNode->prev;
-                newNode->next = curNode;
-                newNode->data = *(ilist.end() - i);
+            other.sentinel.next = &other.sentinel;
+            other.sentinel.prev = &other.sentinel;
+            other.SIZE = 0;
+            compact_from = other.compact_from;
+            other.compact_from = nullptr;
+            spare = other.spare;
+            spares = other.spares;
+            reserved = other.reserved;
+            other.spare = nullptr;
+            other.spares = 0;
+            other.reserved = 0;
+        }
 
-                curNode->prev->next = newNode;
-                curNode->prev = newNode;
-                curNode = newNode;
-            } 
+        /// Destroys the data of a node and keeps it as a spare node if the list has room for one, or else frees it.
+        void destroy_node(Node *oldNode, bool recycle = true)
+        {
+            if (oldNode == compact_from)
+                compact_from = nullptr;
+            node_traits::destroy(alloc, oldNode->data_ptr());
 
-            return pos;
+            if (recycle && spares < reserved)
+                push_spare(oldNode);
+            else
+                free_node(oldNode);
         }
 
-        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
-        iterator erase(iterator pos) {
+        /**
+         * Unlinks n from the list and pushes it onto removed, a chain linked through next, so
+         * that its element stays alive until destroy_removed(). remove() and unique() only destroy
+         * elements after the walk: value, or the state of pred, may refer to one of them.
+         */
+        NodeBase *unlink_into(NodeBase *n, NodeBase *removed)
+        {
+            n->prev->next = n->next;
+            n->next->prev = n->prev;
+            n->next = removed;
             SIZE--;
+            return n;
+        }
 
-            iterator start(begin());
-            Node *delNode = head->next;
-            while (start != pos) {
-                delNode = delNode->next;
-                start++;
+        /// Destroys the nodes of a chain built by unlink_into() and returns how many there were.
+        size_type destroy_removed(NodeBase *removed)
+        {
+            size_type count = 0;
+
+            while (removed != nullptr)
+            {
+                NodeBase *nxt = removed->next;
+                destroy_node(node(removed));
+                stats().on_hops(list_op::erase, 0);
+                removed = nxt;
+                count++;
             }
 
-            delNode->prev->next = delNode->next;
-            delNode->next->prev = delNode->prev;
-            iterator rt(delNode->next);
-            delete delNode;
+            return count;
+        }
 
-            return rt;
+        /// Adds a node with no data to the spare nodes.
+        void push_spare(Node *n)
+        {
+            n->next = spare;
+            spare = n;
+            spares++;
         }
 
-        /// Removes elements in the range [first; last).
-        iterator erase(iterator first, iterator last) {
-            size_type delSize = last - first;        
+        /// Takes a node from the spare nodes, which must not be empty.
+        Node *pop_spare()
+        {
+            Node *n = node(spare);
+            spare = spare->next;
+            spares--;
+            return n;
+        }
 
-            iterator start(begin());
-            Node *curNode = head->next;
-            while (start != first) {
-                curNode = curNode->next;
-                start++;
+        /// Gives the memory of a node with no data back to the node allocator, or to its block.
+        void free_node(Node *oldNode)
+        {
+            Block *b = oldNode->block;
+            if (b == nullptr)
+            {
+                node_traits::deallocate(alloc, oldNode, 1);
+                stats().on_deallocate();
             }
+            else if (--b->live == 0)
+                deallocate_block(b);
+        }
 
-            iterator rt = first;
+        /// Allocates count nodes as one block, constructs their data with make(slot) and links them at the back in address order.
+        template <typename Make>
+        void append_block(size_type count, Make make)
+        {
+            if (count == 0)
+                return;
 
-            for (size_type i = 0; i < delSize; i++) {
-                rt = first + 1;
-                rt = erase(first++);
+            Block *b = allocate_block(count, make);
+            Node *first = first_node(b);
+
+            NodeBase *tail = sentinel.prev;
+            for (size_type i = 0; i < count; i++)
+            {
+                first[i].prev = tail;
+                tail->next = &first[i];
+                tail = &first[i];
             }
+            tail->next = &sentinel;
+            sentinel.prev = tail;
+            SIZE += count;
+            stats().on_grow(SIZE);
+        }
 
-            return rt;
+        /// Allocates a block of count nodes and constructs their data with make(slot). Nothing is linked yet.
+        template <typename Make>
+        Block *allocate_block(size_type count, Make make)
+        {
+            Node *raw = node_traits::allocate(alloc, block_header_nodes + count);
+            stats().on_allocate();
+            Block *b = ::new (static_cast<void *>(raw)) Block{count, count};
+            Node *first = first_node(b);
+            size_type built = 0;
+
+            for (size_type i = 0; i < count; i++)
+                first[i].block = b;
+
+            try
+            {
+                for (; built < count; built++)
+                    make(first[built].data_ptr());
+            }
+            catch (...)
+            {
+                while (built-- > 0)
+                    node_traits::destroy(alloc, first[built].data_ptr());
+                node_traits::deallocate(alloc, raw, block_header_nodes + count);
+                stats().on_deallocate();
+                throw;
+            }
+
+            return b;
         }
 
-        // Find é apontado como quesito de avaliação, mas não é definida e nem existe teste para ela. Por isso não foi implementada.
-        const_iterator find(const T &value) const;
+        /// Moves the elements of the count nodes starting at first to a new block, linked in their place, and frees the old nodes.
+        void relocate(NodeBase *first, size_type count)
+        {
+            NodeBase *from = first;
+            Block *b = allocate_block(count, [this, &from](T *slot) {
+                node_traits::construct(alloc, slot, std::move_if_noexcept(node(from)->data()));
+                from = from->next;
+            });
+            Node *moved = first_node(b);
+
+            // from is now the node after the run. The old nodes keep their links to each other.
+            NodeBase *tail = first->prev;
+            for (size_type i = 0; i < count; i++)
+            {
+                moved[i].prev = tail;
+                tail->next = &moved[i];
+                tail = &moved[i];
+            }
+            tail->next = from;
+            from->prev = tail;
+
+            for (NodeBase *old = first; count > 0; count--)
+            {
+                NodeBase *nxt = old->next;
+                destroy_node(node(old), false);
+                old = nxt;
+            }
+        }
+
+        /// Returns the first of the nodes that follow the header of a block.
+        static Node *first_node(Block *b)
+        {
+            return reinterpret_cast<Node *>(b) + block_header_nodes;
+        }
+
+        /// Gives the memory of a block back to the node allocator.
+        void deallocate_block(Block *b)
+        {
+            size_type n = block_header_nodes + b->count;
+            b->~Block();
+            node_traits::deallocate(alloc, reinterpret_cast<Node *>(b), n);
+            stats().on_deallocate();
+        }
 
-    private:
         size_type SIZE;
-        Node *head;
-        Node *tail;
+        node_allocator alloc;
+        NodeBase sentinel;      //<! End mark, its next is the first node and its prev is the last one
+        NodeBase *compact_from; //<! Node the next compact(budget) resumes from, or nullptr to start from the front
+        NodeBase *spare;        //<! Nodes kept for reuse, with no data, linked through next
+        size_type spares;       //<! Number of spare nodes
+        size_type reserved;     //<! Most spare nodes the list keeps, set by reserve()
     };
 } // namespace sc
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,298 @@
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "indexed_list.hpp"
+
+namespace sc
+{
+    /// Weight of every entry of a cache whose capacity is a number of entries.
+    struct unit_weight
+    {
+        template <typename K, typename V>
+        size_type operator()(const K &, const V &) const { return 1; }
+    };
+
+    /// Counters of a cache, summed over its shards.
+    struct lru_counters
+    {
+        size_type hits = 0;      //<! Lookups that found their key
+        size_type misses = 0;    //<! Lookups that did not
+        size_type evictions = 0; //<! Entries dropped to make room
+    };
+
+    /**
+     * @brief Thread-safe least recently used cache, split into shards with a lock each.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * A key always goes to the same shard, chosen by its hash. Each shard is an sc::indexed_list
+     * in recency order, most recent first, so a lookup finds the node through the hash index and
+     * a hit relinks it to the front in O(1), without allocating. Threads that use keys of
+     * different shards never wait for each other.
+     *
+     * The capacity is split between the shards and is measured by Weigher: with the default
+     * unit_weight it is a number of entries, with a weigher that returns sizes it is a number of
+     * bytes. When a shard goes over its share, its least recently used entries are evicted and
+     * handed to the eviction callback, which runs after the shard lock is released, so it may
+     * use the cache.
+     */
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Weigher = unit_weight>
+    class lru_cache
+    {
+    public:
+        /// Called with each evicted entry.
+        using eviction_callback = std::function<void(const K &, V &&)>;
+
+    private:
+        /// An entry of a shard. The value is not part of the key, so it is updated in place.
+        struct Entry
+        {
+            K key;
+            mutable V value;
+            mutable size_type weight;
+        };
+
+        /// Key of an entry for the index of the shard.
+        struct entry_key
+        {
+            const K &operator()(const Entry &e) const { return e.key; }
+        };
+
+        using entry_list = indexed_list<Entry, Hash, entry_key>;
+
+        /// A lock, a recency list and the counters of the part of the keys that hash to it.
+        struct alignas(64) Shard
+        {
+            std::mutex lock;
+            entry_list entries;     //<! Most recently used first
+            size_type weight = 0;   //<! Sum of the weights of the entries
+            size_type capacity = 0; //<! Largest weight the shard keeps
+            lru_counters counters;
+        };
+
+    public:
+        // [I] SPECIAL MEMBERS
+
+        /**
+         * Creates an empty cache that holds entries of total weight up to capacity. With shards
+         * equal to 0 the count is four per hardware thread; it is rounded up to a power of two
+         * and lowered so that every shard can hold something.
+         */
+        explicit lru_cache(size_type capacity, size_type shards = 0, Weigher weigh = Weigher(), eviction_callback on_evict = nullptr)
+            : weigh{std::move(weigh)}, on_evict{std::move(on_evict)}
+        {
+            if (shards == 0)
+                shards = 4 * std::max<size_type>(1, std::thread::hardware_concurrency());
+
+            n_shards = 1;
+            while (n_shards < shards)
+                n_shards *= 2;
+            while (n_shards > 1 && n_shards > capacity)
+                n_shards /= 2;
+
+            table.reset(new Shard[n_shards]);
+            for (size_type i = 0; i < n_shards; i++)
+                table[i].capacity = capacity / n_shards + (i < capacity % n_shards ? 1 : 0);
+        }
+
+        lru_cache(const lru_cache &) = delete;
+        lru_cache &operator=(const lru_cache &) = delete;
+
+        // [II] LOOKUP
+
+        /// Copies the value of key to out and makes it the most recently used entry of its shard. Returns false on a miss.
+        bool get(const K &key, V &out)
+        {
+            Shard &s = shard_of(key);
+            std::lock_guard<std::mutex> guard(s.lock);
+
+            auto it = s.entries.find(key);
+            if (it == s.entries.end())
+            {
+                s.counters.misses++;
+                return false;
+            }
+
+            out = it->value;
+            s.entries.move_to_front(it);
+            s.counters.hits++;
+            return true;
+        }
+
+        /// Returns true if key is cached, without counting a lookup or changing its recency.
+        bool contains(const K &key)
+        {
+            Shard &s = shard_of(key);
+            std::lock_guard<std::mutex> guard(s.lock);
+
+            return s.entries.contains(key);
+        }
+
+        // [III] MODIFIERS
+
+        /// Inserts key with value, or replaces its value, as the most recently used entry, then evicts what no longer fits.
+        void put(const K &key, V value)
+        {
+            size_type w = weigh(key, value);
+            Shard &s = shard_of(key);
+            std::vector<Entry> evicted;
+
+            {
+                std::lock_guard<std::mutex> guard(s.lock);
+
+                auto it = s.entries.find(key);
+                if (it != s.entries.end())
+                {
+                    s.weight = s.weight - it->weight + w;
+                    it->value = std::move(value);
+                    it->weight = w;
+                    s.entries.move_to_front(it);
+                }
+                else
+                {
+                    s.entries.push_front(Entry{key, std::move(value), w});
+                    s.weight += w;
+                }
+
+                evict(s, evicted);
+            }
+
+            notify(evicted);
+        }
+
+        /// Removes key from the cache, without calling the eviction callback. Returns false if it was not cached.
+        bool erase(const K &key)
+        {
+            Shard &s = shard_of(key);
+            std::lock_guard<std::mutex> guard(s.lock);
+
+            auto it = s.entries.find(key);
+            if (it == s.entries.end())
+                return false;
+
+            s.weight -= it->weight;
+            s.entries.erase(it);
+            return true;
+        }
+
+        /// Removes every entry, without calling the eviction callback. The counters are kept.
+        void clear()
+        {
+            for (size_type i = 0; i < n_shards; i++)
+            {
+                std::lock_guard<std::mutex> guard(table[i].lock);
+                table[i].entries.clear();
+                table[i].weight = 0;
+            }
+        }
+
+        // [IV] CAPACITY AND COUNTERS
+
+        /// Number of cached entries. Exact only while no other thread changes the cache.
+        size_type size() const
+        {
+            size_type total = 0;
+            for (size_type i = 0; i < n_shards; i++)
+            {
+                std::lock_guard<std::mutex> guard(table[i].lock);
+                total += table[i].entries.size();
+            }
+
+            return total;
+        }
+
+        /// Sum of the weights of the cached entries.
+        size_type weight() const
+        {
+            size_type total = 0;
+            for (size_type i = 0; i < n_shards; i++)
+            {
+                std::lock_guard<std::mutex> guard(table[i].lock);
+                total += table[i].weight;
+            }
+
+            return total;
+        }
+
+        /// Largest total weight the cache keeps.
+        size_type capacity() const
+        {
+            size_type total = 0;
+            for (size_type i = 0; i < n_shards; i++)
+                total += table[i].capacity;
+
+            return total;
+        }
+
+        /// Number of shards.
+        size_type shards() const
+        {
+            return n_shards;
+        }
+
+        /// Hits, misses and evictions so far.
+        lru_counters counters() const
+        {
+            lru_counters total;
+            for (size_type i = 0; i < n_shards; i++)
+            {
+                std::lock_guard<std::mutex> guard(table[i].lock);
+                total.hits += table[i].counters.hits;
+                total.misses += table[i].counters.misses;
+                total.evictions += table[i].counters.evictions;
+            }
+
+            return total;
+        }
+
+    private:
+        /// Shard of a key. The hash is remixed, as the index of the shard keeps the top bits of another mix of it.
+        Shard &shard_of(const K &key) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(Hash()(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+
+            return table[h & (n_shards - 1)];
+        }
+
+        /// Drops the least recently used entries of s until it fits, moving them to evicted if there is a callback.
+        void evict(Shard &s, std::vector<Entry> &evicted)
+        {
+            while (s.weight > s.capacity && !s.entries.empty())
+            {
+                const Entry &victim = s.entries.back();
+                s.weight -= victim.weight;
+                if (on_evict)
+                    evicted.push_back(Entry{victim.key, std::move(victim.value), victim.weight});
+
+                s.entries.pop_back();
+                s.counters.evictions++;
+            }
+        }
+
+        /// Calls the eviction callback, with no lock held.
+        void notify(std::vector<Entry> &evicted)
+        {
+            for (Entry &e : evicted)
+                on_evict(e.key, std::move(e.value));
+        }
+
+        std::unique_ptr<Shard[]> table; //<! The shards
+        size_type n_shards;             //<! A power of two
+        Weigher weigh;
+        eviction_callback on_evict;
+    };
+} // namespace sc
+
+#endif
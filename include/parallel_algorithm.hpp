@@ -0,0 +1,146 @@
+#ifndef PARALLEL_ALGORITHM_H
+#define PARALLEL_ALGORITHM_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "list.hpp"
+#include "thread_pool.hpp"
+
+namespace sc
+{
+    /**
+     * Parallel algorithms over sc::list.
+     *
+     * The list is cut into segments of nearly equal length in one pass that only follows links, and
+     * the segments run as tasks of a thread_pool. The number of segments depends only on the size
+     * of the list, never on the number of threads, and reductions combine the per-segment results
+     * from left to right, so the result of an associative operation is the same on every run and
+     * with any pool.
+     */
+    namespace parallel
+    {
+        constexpr size_type min_segment = 4096; //<! Shorter lists are not worth splitting further
+        constexpr size_type max_segments = 256;
+
+        /// Number of segments a list of n elements is cut into.
+        inline size_type segment_count(size_type n)
+        {
+            return std::max<size_type>(1, std::min(max_segments, n / min_segment));
+        }
+
+        /// Length of segment i when n elements are cut into count segments.
+        inline size_type segment_length(size_type n, size_type count, size_type i)
+        {
+            return n / count + (i < n % count ? 1 : 0);
+        }
+
+        /// First iterator of each of count segments of the n elements starting at first.
+        template <typename It>
+        std::vector<It> split(It first, size_type n, size_type count)
+        {
+            std::vector<It> points;
+            points.reserve(count);
+
+            for (size_type i = 0; i < count; i++)
+            {
+                points.push_back(first);
+                for (size_type k = segment_length(n, count, i); k > 0; k--)
+                    ++first;
+            }
+
+            return points;
+        }
+
+        /// Calls f(first, length, i) for every segment i of the n elements starting at first.
+        template <typename It, typename Function>
+        void for_segments(It first, size_type n, thread_pool &pool, Function f)
+        {
+            size_type count = segment_count(n);
+            if (count == 1)
+            {
+                f(first, n, 0);
+                return;
+            }
+
+            std::vector<It> points = split(first, n, count);
+            pool.run(count, [&](std::size_t i) { f(points[i], segment_length(n, count, i), i); });
+        }
+    } // namespace parallel
+
+    /// Calls f on every element of seq. The calls for different segments run concurrently.
+    template <typename T, typename Alloc, typename Stats, typename Function>
+    void parallel_for_each(list<T, Alloc, Stats> &seq, Function f, thread_pool &pool = thread_pool::shared())
+    {
+        parallel::for_segments(seq.begin(), seq.size(), pool, [&f](typename list<T, Alloc, Stats>::iterator it, size_type len, size_type) {
+            for (; len > 0; len--, ++it)
+                f(*it);
+        });
+    }
+
+    /// Replaces every element e of seq with op(e).
+    template <typename T, typename Alloc, typename Stats, typename UnaryOperation>
+    void parallel_transform(list<T, Alloc, Stats> &seq, UnaryOperation op, thread_pool &pool = thread_pool::shared())
+    {
+        parallel::for_segments(seq.begin(), seq.size(), pool, [&op](typename list<T, Alloc, Stats>::iterator it, size_type len, size_type) {
+            for (; len > 0; len--, ++it)
+                *it = op(std::move(*it));
+        });
+    }
+
+    /// Folds the elements of seq into init with op, which must be associative.
+    template <typename T, typename Alloc, typename Stats, typename U, typename BinaryOperation>
+    U parallel_reduce(const list<T, Alloc, Stats> &seq, U init, BinaryOperation op, thread_pool &pool = thread_pool::shared())
+    {
+        size_type n = seq.size();
+        if (n == 0)
+            return init;
+
+        // Each segment is folded starting from its own first element, so init is used only once.
+        std::vector<U> partial(parallel::segment_count(n), init);
+        parallel::for_segments(seq.cbegin(), n, pool, [&](typename list<T, Alloc, Stats>::const_iterator it, size_type len, size_type i) {
+            U acc(*it);
+            for (++it, --len; len > 0; len--, ++it)
+                acc = op(std::move(acc), *it);
+            partial[i] = std::move(acc);
+        });
+
+        for (auto &p : partial)
+            init = op(std::move(init), std::move(p));
+        return init;
+    }
+
+    /// Folds the elements of seq with std::plus, starting from T{}.
+    template <typename T, typename Alloc, typename Stats>
+    T parallel_reduce(const list<T, Alloc, Stats> &seq, thread_pool &pool = thread_pool::shared())
+    {
+        return parallel_reduce(seq, T{}, std::plus<>(), pool);
+    }
+
+    /// Returns the number of elements of seq for which pred is true.
+    template <typename T, typename Alloc, typename Stats, typename UnaryPredicate>
+    size_type parallel_count_if(const list<T, Alloc, Stats> &seq, UnaryPredicate pred, thread_pool &pool = thread_pool::shared())
+    {
+        size_type n = seq.size();
+        std::vector<size_type> partial(parallel::segment_count(n), 0);
+
+        parallel::for_segments(seq.cbegin(), n, pool, [&](typename list<T, Alloc, Stats>::const_iterator it, size_type len, size_type i) {
+            size_type c = 0;
+            for (; len > 0; len--, ++it)
+            {
+                if (pred(*it))
+                    c++;
+            }
+            partial[i] = c;
+        });
+
+        size_type total = 0;
+        for (auto c : partial)
+            total += c;
+        return total;
+    }
+} // namespace sc
+
+#endif
@@ -0,0 +1,720 @@
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /// How a persistent_list orders its writes to the file.
+    enum class durability
+    {
+        relaxed, //<! The kernel writes pages back in any order: only a list that was closed is guaranteed to reopen
+        ordered  //<! Each insertion or removal is committed by one msync'd link write, so the list survives a crash
+    };
+
+    /**
+     * @brief Doubly linked list whose nodes live in a memory-mapped file.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * The file holds a header, with the sentinel, followed by the nodes. Links are byte offsets
+     * from the start of the file instead of pointers, so the file can be mapped anywhere and
+     * opening it again gives the list back at once, with nothing to deserialize. Erased nodes go
+     * to a free list threaded through the file and are reused before the file grows, which it
+     * does by doubling. T must be trivially copyable, as its bytes are the stored form.
+     *
+     * Iterators hold an offset, so they stay valid when the file grows and is mapped again
+     * (references do not). Changes made to elements in place reach the disk on flush() or when
+     * the list is destroyed.
+     *
+     * The header records whether the list was closed. If it was not, because the process died,
+     * opening the list walks the next links from the sentinel and rebuilds the prev links, the
+     * size and the free list from them. With durability::ordered the next links are always a
+     * valid list: a node is written and synced before the one link that makes it reachable, and
+     * a node leaves the list by one synced link write before it is reused.
+     */
+    template <typename T>
+    class persistent_list
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "The elements are stored as their bytes");
+
+    private:
+        using offset = std::uint64_t;
+
+        /// Links of the sentinel and of the nodes, as offsets in the file.
+        struct Link
+        {
+            offset prev; //<! Offset of the previous node in the list
+            offset next; //<! Offset of the next node in the list, or of the next free node
+        };
+
+        /// Representation of a node in the file.
+        struct Node : Link
+        {
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(reinterpret_cast<T *>(storage)); }
+        };
+
+        /// Start of the file.
+        struct Header
+        {
+            char magic[8];              //<! "SCPLIST"
+            std::uint32_t version;      //<! Version of the layout
+            std::uint32_t element_size; //<! sizeof(T) of the list that created the file
+            offset top;                 //<! End of the nodes handed out so far, the rest of the file is unused
+            offset free_head;           //<! First free node, or none
+            std::uint64_t size;         //<! Number of elements
+            std::uint32_t closed;       //<! 1 if the list was closed after its last change
+            std::uint32_t reserved;     //<! Keeps the sentinel 8-byte aligned
+            Link sentinel;              //<! End mark, its next is the first node and its prev is the last one
+        };
+
+        static constexpr char magic[8] = {'S', 'C', 'P', 'L', 'I', 'S', 'T', '\0'};
+        static constexpr std::uint32_t version = 1;
+        static constexpr offset none = 0;                                 //<! Ends the free list, the header is never a node
+        static constexpr offset sentinel_at = offsetof(Header, sentinel); //<! Offset of the sentinel
+        static constexpr offset first_node = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+        static constexpr std::size_t initial_length = 64 * 1024;
+
+    public:
+        /**
+         * @brief Constant iterator of a persistent list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates the list and the offset of a node.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : owner{nullptr}, at{none} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return owner->node(at).data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                at = owner->link(at).next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                at = owner->link(at).prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return at == rhs.at && owner == rhs.owner;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+        protected:
+            const persistent_list *owner; //<! The list, whose file may be mapped again.
+            offset at;                    //<! Offset of the node.
+            const_iterator(const persistent_list *o, offset a) : owner(o), at(a) {}
+            friend class persistent_list;
+        };
+
+        /**
+         * @brief Iterator of a persistent list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates the list and the offset of a node.
+         */
+        class iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            iterator() : owner{nullptr}, at{none} {}
+
+            /// Return a const reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return owner->node(at).data(); }
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() { return owner->node(at).data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                at = owner->link(at).next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator and returns it.
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            friend iterator operator+(iterator it, int n)
+            {
+                for (int i = 0; i < n; i++)
+                    ++it;
+
+                return it;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator &operator--()
+            {
+                at = owner->link(at).prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns the distance between the elements (not between the adresses).
+            size_type operator-(iterator rhs) const
+            {
+                size_type dis = 0;
+
+                for (; rhs.at != at; ++rhs)
+                    dis++;
+
+                return dis;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return at == rhs.at && owner == rhs.owner;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(owner, at); }
+
+        protected:
+            persistent_list *owner; //<! The list, whose file may be mapped again.
+            offset at;              //<! Offset of the node.
+            iterator(persistent_list *o, offset a) : owner(o), at(a) {}
+            friend class persistent_list;
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /**
+         * Opens the list stored in the file at path, creating an empty one if the file does not
+         * exist or is empty. Throws std::system_error if the file cannot be opened, grown or
+         * mapped, and std::runtime_error if it does not hold a list of T or cannot be recovered.
+         */
+        explicit persistent_list(const std::string &path, durability mode = durability::relaxed)
+            : fd{-1}, base{nullptr}, length{0}, mode{mode}, was_recovered{false}
+        {
+            fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd < 0)
+                fail("open " + path);
+
+            try
+            {
+                struct stat st;
+                if (::fstat(fd, &st) != 0)
+                    fail("fstat " + path);
+
+                if (st.st_size == 0)
+                {
+                    create();
+                }
+                else
+                {
+                    if (static_cast<std::size_t>(st.st_size) < first_node)
+                        throw std::runtime_error("sc::persistent_list: " + path + " is not a persistent list");
+
+                    map(static_cast<std::size_t>(st.st_size));
+                    check(path);
+                }
+
+                if (!head().closed)
+                    recover(path);
+
+                // Synced in both modes, so that a crash is always noticed on the next open.
+                head().closed = 0;
+                if (::msync(base, page_size(), MS_SYNC) != 0)
+                    fail("msync");
+            }
+            catch (...)
+            {
+                unmap();
+                ::close(fd);
+                throw;
+            }
+        }
+
+        persistent_list(const persistent_list &) = delete;
+        persistent_list &operator=(const persistent_list &) = delete;
+
+        /// Destructor. Writes everything back and marks the list as closed.
+        ~persistent_list()
+        {
+            ::msync(base, length, MS_SYNC);
+            head().closed = 1;
+            ::msync(base, page_size(), MS_SYNC);
+            unmap();
+            ::close(fd);
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(this, head().sentinel.next);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(this, sentinel_at);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(this, head().sentinel.next);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(this, sentinel_at);
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return head().size;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return head().size == 0;
+        }
+
+        /// Number of elements that fit without growing the file.
+        size_type capacity() const
+        {
+            size_type free = 0;
+            for (offset f = head().free_head; f != none; f = link(f).next)
+                free++;
+
+            return head().size + free + (length - head().top) / sizeof(Node);
+        }
+
+        /// Returns true if opening the file had to rebuild the list because it was not closed.
+        bool recovered() const
+        {
+            return was_recovered;
+        }
+
+        // [IV] MODIFIERS
+
+        /// Remove all elements from the container. The file keeps its length.
+        void clear()
+        {
+            Header &h = head();
+
+            h.sentinel.next = sentinel_at;
+            persist(sentinel_at, sizeof(Link));
+
+            h.sentinel.prev = sentinel_at;
+            h.top = first_node;
+            h.free_head = none;
+            h.size = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return *begin();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return *cbegin();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return node(head().sentinel.prev).data();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return node(head().sentinel.prev).data();
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            insert(begin(), value);
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            insert(end(), value);
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase(iterator(this, head().sentinel.prev));
+        }
+
+        /// Adds value into the list before pos and returns an iterator to the inserted item. May grow the file.
+        iterator insert(iterator pos, const T &value)
+        {
+            // value may be an element of this list, which moves if the file is mapped again.
+            const T copy = value;
+            offset n = take_node();
+
+            offset p = pos.at;
+            offset before = link(p).prev;
+            Node &fresh = node(n);
+            std::memcpy(fresh.storage, &copy, sizeof(T));
+            fresh.prev = before;
+            fresh.next = p;
+            persist(n, sizeof(Node));
+
+            // The commit: from here on the node is in the list.
+            link(before).next = n;
+            persist(before + offsetof(Link, next), sizeof(offset));
+
+            link(p).prev = n;
+            head().size++;
+
+            return iterator(this, n);
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            if (first == last)
+                return pos;
+
+            iterator firstInserted = insert(pos, *first);
+            for (++first; first != last; ++first)
+                insert(pos, *first);
+
+            return firstInserted;
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos)
+        {
+            offset n = pos.at;
+            offset before = link(n).prev;
+            offset after = link(n).next;
+
+            // The commit: from here on the node is out of the list.
+            link(before).next = after;
+            persist(before + offsetof(Link, next), sizeof(offset));
+
+            link(after).prev = before;
+            give_node(n);
+            head().size--;
+
+            return iterator(this, after);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+
+            return last;
+        }
+
+        /// Writes every change, including the ones made to elements in place, to the file.
+        void flush()
+        {
+            if (::msync(base, length, MS_SYNC) != 0)
+                fail("msync");
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const persistent_list &lhs, const persistent_list &rhs)
+        {
+            if (lhs.size() != rhs.size())
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (*l != *r)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const persistent_list &lhs, const persistent_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        Header &head() const { return *reinterpret_cast<Header *>(base); }
+        Link &link(offset at) const { return *reinterpret_cast<Link *>(base + at); }
+        Node &node(offset at) const { return *reinterpret_cast<Node *>(base + at); }
+
+        static std::size_t page_size()
+        {
+            static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+            return page;
+        }
+
+        [[noreturn]] static void fail(const std::string &what)
+        {
+            throw std::system_error(errno, std::generic_category(), "sc::persistent_list: " + what);
+        }
+
+        /// Maps the first n bytes of the file, replacing the current mapping.
+        void map(std::size_t n)
+        {
+            void *p = ::mmap(nullptr, n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED)
+                fail("mmap");
+
+            unmap();
+            base = static_cast<char *>(p);
+            length = n;
+        }
+
+        void unmap()
+        {
+            if (base != nullptr)
+                ::munmap(base, length);
+            base = nullptr;
+        }
+
+        /// Syncs the pages that hold the n bytes at offset at, in durability::ordered mode.
+        void persist(offset at, std::size_t n)
+        {
+            if (mode != durability::ordered)
+                return;
+
+            std::size_t first = at / page_size() * page_size();
+            if (::msync(base + first, at + n - first, MS_SYNC) != 0)
+                fail("msync");
+        }
+
+        /// Lays out an empty list in the new file.
+        void create()
+        {
+            if (::ftruncate(fd, initial_length) != 0)
+                fail("ftruncate");
+            map(initial_length);
+
+            Header &h = head();
+            h.version = version;
+            h.element_size = sizeof(T);
+            h.top = first_node;
+            h.free_head = none;
+            h.size = 0;
+            h.closed = 1;
+            h.reserved = 0;
+            h.sentinel.prev = h.sentinel.next = sentinel_at;
+
+            // Written last, so a file cut short while being created is not taken for a list.
+            persist(0, sizeof(Header));
+            std::memcpy(h.magic, magic, sizeof(magic));
+            persist(0, sizeof(Header));
+        }
+
+        /// Throws if the mapped file is not a list of T.
+        void check(const std::string &path) const
+        {
+            const Header &h = head();
+
+            if (std::memcmp(h.magic, magic, sizeof(magic)) != 0)
+                throw std::runtime_error("sc::persistent_list: " + path + " is not a persistent list");
+            if (h.version != version)
+                throw std::runtime_error("sc::persistent_list: " + path + " has an unknown layout version");
+            if (h.element_size != sizeof(T))
+                throw std::runtime_error("sc::persistent_list: " + path + " holds elements of another size");
+        }
+
+        /// Returns true if at is the offset of a node inside the file.
+        bool valid_node(offset at) const
+        {
+            return at >= first_node && at + sizeof(Node) <= length && (at - first_node) % sizeof(Node) == 0;
+        }
+
+        /// Rebuilds the prev links, the size, the end of the used nodes and the free list from the next links.
+        void recover(const std::string &path)
+        {
+            Header &h = head();
+            std::vector<bool> reached((length - first_node) / sizeof(Node));
+            offset prev = sentinel_at;
+            offset top = h.top <= length && h.top >= first_node ? h.top : first_node;
+            std::uint64_t count = 0;
+
+            for (offset at = h.sentinel.next; at != sentinel_at; at = link(at).next)
+            {
+                if (!valid_node(at) || reached[(at - first_node) / sizeof(Node)])
+                    throw std::runtime_error("sc::persistent_list: " + path + " cannot be recovered");
+
+                std::size_t i = (at - first_node) / sizeof(Node);
+
+                reached[i] = true;
+                link(at).prev = prev;
+                prev = at;
+                count++;
+                if (at + sizeof(Node) > top)
+                    top = at + sizeof(Node);
+            }
+
+            h.sentinel.prev = prev;
+            h.size = count;
+            h.top = top - (top - first_node) % sizeof(Node);
+
+            // Every node below top that the list does not reach is free, including the ones
+            // that were being inserted or erased when the process stopped.
+            h.free_head = none;
+            for (offset at = h.top; at > first_node;)
+            {
+                at -= sizeof(Node);
+                if (!reached[(at - first_node) / sizeof(Node)])
+                    give_node(at);
+            }
+
+            if (::msync(base, length, MS_SYNC) != 0)
+                fail("msync");
+            was_recovered = true;
+        }
+
+        /// Returns the offset of an unused node, taken from the free list or from a file grown if needed.
+        offset take_node()
+        {
+            Header &h = head();
+
+            if (h.free_head != none)
+            {
+                offset n = h.free_head;
+                h.free_head = link(n).next;
+                return n;
+            }
+
+            if (h.top + sizeof(Node) > length)
+                grow();
+
+            offset n = head().top;
+            head().top += sizeof(Node);
+            return n;
+        }
+
+        /// Puts the node at the top of the free list.
+        void give_node(offset n)
+        {
+            link(n).next = head().free_head;
+            head().free_head = n;
+        }
+
+        /// Doubles the length of the file and maps it again.
+        void grow()
+        {
+            std::size_t n = 2 * length;
+
+            if (::ftruncate(fd, static_cast<off_t>(n)) != 0)
+                fail("ftruncate");
+            map(n);
+        }
+
+        int fd;             //<! The file
+        char *base;         //<! Address where the file is mapped
+        std::size_t length; //<! Bytes of the file, all of them mapped
+        durability mode;
+        bool was_recovered; //<! Whether opening the file rebuilt the list
+    };
+} // namespace sc
+
+#endif
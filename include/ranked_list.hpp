@@ -0,0 +1,849 @@
+#ifndef RANKED_LIST_H
+#define RANKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Doubly linked list with an order-statistic index, implemented as an indexable skip list.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Level 0 is an ordinary doubly linked list closed by a sentinel, just like sc::list. On top of
+     * it, each node has a random number of extra forward links (a quarter of the nodes reach level 1,
+     * a sixteenth level 2, and so on) and every link stores how many elements it skips. A link that
+     * would reach past the last element is null and its width counts up to the end mark.
+     *
+     * With that, nth(), advance(), distance() and index_of() take O(log n) expected steps and so do
+     * iterator + int and iterator - iterator. Inserting and erasing at an iterator stay O(1) at the
+     * links of the node itself, plus O(log n) expected to fix the widths of the links above it.
+     */
+    template <typename T, typename Alloc = std::allocator<T>>
+    class ranked_list
+    {
+    private:
+        static constexpr unsigned max_level = 32; //<! Height of the sentinel, nodes are always lower
+
+        struct NodeBase;
+
+        /// Forward link of one level and the number of elements it skips.
+        struct Link
+        {
+            NodeBase *next;  //<! Next node of the same level, nullptr past the last one
+            size_type width; //<! Difference between the positions of next and of the owner
+        };
+
+        /// Links of a node, also used by the sentinel.
+        struct NodeBase
+        {
+            NodeBase *prev;  //<! Pointer to the previous node in the list
+            Link base;       //<! Level 0 link, never null
+            Link *up;        //<! Links of levels [1, height), nullptr when height is 1
+            unsigned height; //<! Number of levels the node takes part of
+
+            /// Returns the link of level l.
+            Link &link(unsigned l) { return l == 0 ? base : up[l - 1]; }
+
+            /// Returns the highest link.
+            Link &top() { return link(height - 1); }
+
+            /// Number of elements from this node to the end mark, following the highest links.
+            size_type distance_to_end()
+            {
+                size_type dis = 0;
+
+                for (NodeBase *cur = this; cur != nullptr && cur->height != max_level;)
+                {
+                    dis += cur->top().width;
+                    cur = cur->top().next;
+                }
+
+                return dis;
+            }
+
+            /// Returns the node n positions ahead, climbing and descending through the levels, or the end mark if there are fewer.
+            NodeBase *forward(size_type n)
+            {
+                NodeBase *cur = this;
+
+                while (n > 0 && cur->height != max_level)
+                {
+                    unsigned l = cur->height - 1;
+                    while (l > 0 && (cur->link(l).next == nullptr || cur->link(l).width > n))
+                        l--;
+
+                    n -= cur->link(l).width;
+                    cur = cur->link(l).next;
+                }
+
+                return cur;
+            }
+        };
+
+        /// Representation of a node, it contains the links and a data.
+        struct Node : NodeBase
+        {
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+        };
+
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+        using link_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Link>;
+        using link_traits = std::allocator_traits<link_allocator>;
+
+    public:
+        /**
+         * @brief Constant iterator of a ranked list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                current = current->base.next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(*this);
+                current = current->base.next;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(*this);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator in O(log n) expected steps, stopping at the end mark. A negative n leaves it unchanged, as with sc::list.
+            friend const_iterator operator+(const_iterator it, int n)
+            {
+                return n > 0 ? const_iterator(it.current->forward(static_cast<size_type>(n))) : it;
+            }
+
+            friend const_iterator operator+(int n, const_iterator it)
+            {
+                return it + n;
+            }
+
+            /// Returns the distance between the elements (not between the adresses) in O(log n) expected steps.
+            size_type operator-(const_iterator rhs) const
+            {
+                return rhs.current->distance_to_end() - current->distance_to_end();
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+        protected:
+            NodeBase *current; //<! The node that holds the element.
+            explicit const_iterator(NodeBase *p) : current(p) {}
+            friend class ranked_list;
+        };
+
+        /**
+         * @brief Iterator of a ranked list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            iterator() : current{nullptr} {}
+
+            /// Return a const reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                current = current->base.next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(*this);
+                current = current->base.next;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(*this);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator in O(log n) expected steps, stopping at the end mark. A negative n leaves it unchanged, as with sc::list.
+            friend iterator operator+(iterator it, int n)
+            {
+                return n > 0 ? iterator(it.current->forward(static_cast<size_type>(n))) : it;
+            }
+
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            /// Returns the distance between the elements (not between the adresses) in O(log n) expected steps.
+            size_type operator-(iterator rhs) const
+            {
+                return rhs.current->distance_to_end() - current->distance_to_end();
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current); }
+
+        protected:
+            NodeBase *current; //<! The node that holds the element.
+            explicit iterator(NodeBase *p) : current(p) {}
+            friend class ranked_list;
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        ranked_list() : ranked_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its nodes from alloc.
+        explicit ranked_list(const Alloc &a) : SIZE{0}, levels{1}, seed{0x9E3779B97F4A7C15ull}, alloc{a}, link_alloc{a}
+        {
+            sentinel.up = sentinel_up;
+            sentinel.height = max_level;
+            reset_sentinel();
+        }
+
+        /// Constructs the list with count default-inserted instances of T.
+        explicit ranked_list(size_type count, const Alloc &a = Alloc()) : ranked_list(a)
+        {
+            for (size_type i = 0; i < count; i++)
+                emplace_back();
+        }
+
+        /// Constructs the list with the contents of the range [first, last).
+        template <typename InputIt>
+        ranked_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : ranked_list(a)
+        {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+
+        /// Constructs the list with the contents of the initializer list init.
+        ranked_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : ranked_list(ilist.begin(), ilist.end(), a) {}
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other.
+        ranked_list(const ranked_list &other)
+            : ranked_list(other.begin(), other.end(), Alloc(node_traits::select_on_container_copy_construction(other.alloc)))
+        {
+        }
+
+        /// Move constructor. Takes over the nodes of other in O(1), leaving other empty.
+        ranked_list(ranked_list &&other) noexcept : ranked_list(Alloc(other.alloc))
+        {
+            take_nodes(other);
+        }
+
+        /// Destructor
+        ~ranked_list()
+        {
+            clear();
+        }
+
+        /// Copy the size and values from another list.
+        ranked_list &operator=(const ranked_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto &value : other)
+                    emplace_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the nodes of other, leaving it empty.
+        ranked_list &operator=(ranked_list &&other) noexcept(node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            if (node_traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = other.alloc;
+                link_alloc = other.link_alloc;
+                take_nodes(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                take_nodes(other);
+            }
+            else
+            {
+                for (auto &value : other)
+                    emplace_back(std::move(value));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        /// Replaces the contents with those identified by initializer list ilist.
+        ranked_list &operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            for (const T &value : ilist)
+                emplace_back(value);
+
+            return *this;
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(sentinel.base.next);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(&sentinel);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(sentinel.base.next);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(const_cast<NodeBase *>(&sentinel));
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        // [IV] POSITIONAL ACCESS
+
+        /// Returns an iterator to the element at index i, or end() if i is size().
+        iterator nth(size_type i)
+        {
+            return iterator(locate(i + 1));
+        }
+
+        /// Returns a constant iterator to the element at index i, or end() if i is size().
+        const_iterator nth(size_type i) const
+        {
+            return const_iterator(const_cast<ranked_list *>(this)->locate(i + 1));
+        }
+
+        /// Returns the element at index i.
+        T &operator[](size_type i)
+        {
+            return *nth(i);
+        }
+
+        /// Returns the element at index i.
+        const T &operator[](size_type i) const
+        {
+            return *nth(i);
+        }
+
+        /// Returns the index of the element pointed by it, or size() for end().
+        size_type index_of(const_iterator it) const
+        {
+            return SIZE - it.current->distance_to_end();
+        }
+
+        /// Moves it n positions, backwards when n is negative.
+        void advance(iterator &it, std::ptrdiff_t n)
+        {
+            it = nth(index_of(it) + n);
+        }
+
+        /// Moves it n positions, backwards when n is negative.
+        void advance(const_iterator &it, std::ptrdiff_t n) const
+        {
+            it = nth(index_of(it) + n);
+        }
+
+        /// Returns the number of steps from first to last, negative when last comes before first.
+        std::ptrdiff_t distance(const_iterator first, const_iterator last) const
+        {
+            return std::ptrdiff_t(first.current->distance_to_end()) - std::ptrdiff_t(last.current->distance_to_end());
+        }
+
+        // [V] MODIFIERS
+
+        /// Remove all elements from the container.
+        void clear()
+        {
+            NodeBase *cur = sentinel.base.next;
+
+            while (cur != &sentinel)
+            {
+                NodeBase *nxt = cur->base.next;
+                destroy_node(static_cast<Node *>(cur));
+                cur = nxt;
+            }
+
+            reset_sentinel();
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return *begin();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return *cbegin();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return *--end();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return *--cend();
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            emplace_front(value);
+        }
+
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace_front(std::move(value));
+        }
+
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return static_cast<Node *>(insert_at(1, create_node(std::forward<Args>(args)...)))->data();
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            emplace_back(value);
+        }
+
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return static_cast<Node *>(insert_at(SIZE + 1, create_node(std::forward<Args>(args)...)))->data();
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase_at(1);
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase_at(SIZE);
+        }
+
+        /// Adds value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, const T &value)
+        {
+            return emplace(pos, value);
+        }
+
+        /// Moves value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            size_type r = index_of(pos) + 1;
+            NodeBase *firstInserted = pos.current;
+
+            for (size_type i = 0; first != last; ++first, ++i)
+            {
+                NodeBase *newNode = insert_at(r + i, create_node(*first));
+                if (i == 0)
+                    firstInserted = newNode;
+            }
+
+            return iterator(firstInserted);
+        }
+
+        /// Inserts elements from the initializer list ilist before pos and returns an iterator to the first inserted item.
+        iterator insert(iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Constructs an element in place before pos and returns an iterator to it.
+        template <typename... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            Node *newNode = create_node(std::forward<Args>(args)...);
+            return iterator(insert_at(index_of(pos) + 1, newNode));
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos)
+        {
+            NodeBase *nxt = pos.current->base.next;
+            erase_at(index_of(pos) + 1);
+            return iterator(nxt);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            size_type r = index_of(first) + 1;
+
+            for (size_type n = last - first; n > 0; n--)
+                erase_at(r);
+
+            return last;
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const ranked_list &lhs, const ranked_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (*l != *r)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const ranked_list &lhs, const ranked_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// Height of a new node: one level more with probability 1/4 each, up to max_level - 1.
+        unsigned random_height()
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            unsigned h = 1;
+            for (std::uint64_t bits = seed; h < max_level - 1 && (bits & 3) == 0; bits >>= 2)
+                h++;
+
+            return h;
+        }
+
+        /**
+         * Walks from the sentinel (position 0) down to the node at position p, in [0, SIZE + 1].
+         * When path is given, path[l] and at[l] receive the last node of level l at or before p and its position.
+         */
+        NodeBase *locate(size_type p, NodeBase **path = nullptr, size_type *at = nullptr)
+        {
+            if (p > SIZE)
+                return &sentinel;
+
+            NodeBase *cur = &sentinel;
+            size_type pos = 0;
+
+            for (unsigned l = levels; l-- > 0;)
+            {
+                for (;;)
+                {
+                    Link &lk = cur->link(l);
+                    if (lk.next == nullptr || lk.next == &sentinel || pos + lk.width > p)
+                        break;
+
+                    pos += lk.width;
+                    cur = lk.next;
+                }
+
+                if (path != nullptr)
+                {
+                    path[l] = cur;
+                    at[l] = pos;
+                }
+            }
+
+            return cur;
+        }
+
+        /// Links newNode so that it ends up at position r, in [1, SIZE + 1], and returns it.
+        NodeBase *insert_at(size_type r, Node *newNode)
+        {
+            NodeBase *path[max_level];
+            size_type at[max_level];
+            locate(r - 1, path, at);
+
+            unsigned h = newNode->height;
+            for (; levels < h; levels++)
+            {
+                sentinel_up[levels - 1] = Link{nullptr, SIZE + 1};
+                path[levels] = &sentinel;
+                at[levels] = 0;
+            }
+
+            for (unsigned l = 0; l < h; l++)
+            {
+                Link &before = path[l]->link(l);
+                newNode->link(l) = Link{before.next, at[l] + before.width + 1 - r};
+                before = Link{newNode, r - at[l]};
+            }
+
+            for (unsigned l = h; l < levels; l++)
+                path[l]->link(l).width++;
+
+            newNode->prev = path[0];
+            newNode->base.next->prev = newNode;
+            SIZE++;
+
+            return newNode;
+        }
+
+        /// Unlinks and destroys the node at position r, in [1, SIZE].
+        void erase_at(size_type r)
+        {
+            NodeBase *path[max_level];
+            size_type at[max_level];
+            NodeBase *target = locate(r - 1, path, at)->base.next;
+
+            for (unsigned l = 0; l < target->height; l++)
+            {
+                Link &before = path[l]->link(l);
+                before = Link{target->link(l).next, before.width + target->link(l).width - 1};
+            }
+
+            for (unsigned l = target->height; l < levels; l++)
+                path[l]->link(l).width--;
+
+            target->base.next->prev = target->prev;
+            SIZE--;
+
+            while (levels > 1 && sentinel.link(levels - 1).next == nullptr)
+                levels--;
+
+            destroy_node(static_cast<Node *>(target));
+        }
+
+        /// Allocates a node with a random height and constructs its data from args.
+        template <typename... Args>
+        Node *create_node(Args &&...args)
+        {
+            unsigned h = random_height();
+            Link *up = h > 1 ? link_traits::allocate(link_alloc, h - 1) : nullptr;
+            Node *newNode;
+
+            try
+            {
+                newNode = node_traits::allocate(alloc, 1);
+            }
+            catch (...)
+            {
+                if (up != nullptr)
+                    link_traits::deallocate(link_alloc, up, h - 1);
+                throw;
+            }
+
+            try
+            {
+                node_traits::construct(alloc, newNode->data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                node_traits::deallocate(alloc, newNode, 1);
+                if (up != nullptr)
+                    link_traits::deallocate(link_alloc, up, h - 1);
+                throw;
+            }
+
+            newNode->up = up;
+            newNode->height = h;
+            return newNode;
+        }
+
+        /// Destroys the data of a node and gives its memory back to the allocator.
+        void destroy_node(Node *node)
+        {
+            node_traits::destroy(alloc, node->data_ptr());
+            if (node->up != nullptr)
+                link_traits::deallocate(link_alloc, node->up, node->height - 1);
+            node_traits::deallocate(alloc, node, 1);
+        }
+
+        /// Moves every node of other to this list, which must be empty, and leaves other empty.
+        void take_nodes(ranked_list &other)
+        {
+            if (other.SIZE == 0)
+                return;
+
+            sentinel.base = other.sentinel.base;
+            sentinel.prev = other.sentinel.prev;
+            for (unsigned l = 1; l < other.levels; l++)
+                sentinel_up[l - 1] = other.sentinel_up[l - 1];
+
+            // Only level 0 links back to the sentinel.
+            sentinel.base.next->prev = &sentinel;
+            sentinel.prev->base.next = &sentinel;
+            SIZE = other.SIZE;
+            levels = other.levels;
+
+            other.reset_sentinel();
+            other.SIZE = 0;
+        }
+
+        /// Links the sentinel to itself and unsets its links above level 0, so that walks skip them.
+        void reset_sentinel()
+        {
+            sentinel.prev = &sentinel;
+            sentinel.base = Link{&sentinel, 1};
+            for (Link &l : sentinel_up)
+                l = Link{nullptr, 0};
+            levels = 1;
+        }
+
+        size_type SIZE;
+        unsigned levels;    //<! Levels in use, the sentinel links above them are null
+        std::uint64_t seed; //<! State of the generator of node heights
+        node_allocator alloc;
+        link_allocator link_alloc;
+        NodeBase sentinel;                //<! End mark (position 0 and SIZE + 1), its next is the first node and its prev is the last one
+        Link sentinel_up[max_level - 1]; //<! Links of the sentinel above level 0
+    };
+} // namespace sc
+
+#endif
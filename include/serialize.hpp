@@ -0,0 +1,432 @@
+#ifndef SERIALIZE_H
+#define SERIALIZE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /// Thrown when a stream cannot be written, or does not hold a list in the expected format.
+    class serialization_error : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @brief Bytes of a frame being encoded, handed to serializer<T>::save().
+     * @author Eduardo Sarmento & Victor Vieira
+     */
+    class byte_writer
+    {
+    public:
+        /// Appends n bytes starting at p.
+        void write(const void *p, std::size_t n)
+        {
+            const char *c = static_cast<const char *>(p);
+            bytes.insert(bytes.end(), c, c + n);
+        }
+
+        /// Appends the object representation of value.
+        template <typename U>
+        void put(const U &value)
+        {
+            static_assert(std::is_trivially_copyable<U>::value, "put() copies the bytes of the object");
+            write(&value, sizeof(U));
+        }
+
+        /// Returns the bytes written so far.
+        const char *data() const { return bytes.data(); }
+
+        /// Returns the number of bytes written so far.
+        std::size_t size() const { return bytes.size(); }
+
+        /// Forgets every byte written, to start a new frame.
+        void clear() { bytes.clear(); }
+
+    private:
+        std::vector<char> bytes;
+    };
+
+    /**
+     * @brief Bytes of a frame being decoded, handed to serializer<T>::load().
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Reading past the end of the frame throws sc::serialization_error.
+     */
+    class byte_reader
+    {
+    public:
+        byte_reader(const char *first, const char *last) : cur{first}, last{last} {}
+
+        /// Copies the next n bytes to p.
+        void read(void *p, std::size_t n)
+        {
+            if (n > remaining())
+                throw serialization_error("sc::byte_reader: element crosses the end of its frame");
+
+            std::memcpy(p, cur, n);
+            cur += n;
+        }
+
+        /// Reads an object written by byte_writer::put().
+        template <typename U>
+        U get()
+        {
+            static_assert(std::is_trivially_copyable<U>::value, "get() copies the bytes of the object");
+            U value;
+            read(&value, sizeof(U));
+            return value;
+        }
+
+        /// Returns the number of bytes left in the frame.
+        std::size_t remaining() const { return static_cast<std::size_t>(last - cur); }
+
+    private:
+        const char *cur;
+        const char *last;
+    };
+
+    /**
+     * @brief Customization point that encodes elements of type T.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Trivially copyable types need nothing: their bytes are copied in bulk. Other types are
+     * written through a specialization with these members:
+     *
+     *     static void save(sc::byte_writer &out, const T &value);
+     *     static T load(sc::byte_reader &in);
+     *
+     * A specialization also takes over a trivially copyable type, for example to skip padding
+     * or to make its format independent of the byte order of the machine.
+     */
+    template <typename T, typename = void>
+    struct serializer;
+
+    template <typename T>
+    struct serializer<T, std::enable_if_t<std::is_trivially_copyable<T>::value>>
+    {
+        static constexpr bool raw = true; //<! Elements are stored as their object representation
+    };
+
+    /// Strings are stored as their length followed by their characters.
+    template <typename CharT, typename Traits, typename A>
+    struct serializer<std::basic_string<CharT, Traits, A>>
+    {
+        static void save(byte_writer &out, const std::basic_string<CharT, Traits, A> &s)
+        {
+            out.put(static_cast<std::uint64_t>(s.size()));
+            out.write(s.data(), s.size() * sizeof(CharT));
+        }
+
+        static std::basic_string<CharT, Traits, A> load(byte_reader &in)
+        {
+            std::uint64_t n = in.get<std::uint64_t>();
+            if (n > in.remaining() / sizeof(CharT))
+                throw serialization_error("sc::serializer<std::basic_string>: length crosses the end of its frame");
+
+            std::basic_string<CharT, Traits, A> s(static_cast<std::size_t>(n), CharT());
+            in.read(&s[0], s.size() * sizeof(CharT));
+            return s;
+        }
+    };
+
+    /**
+     * Binary format of sc::save() and sc::load().
+     *
+     * A 24-byte header (magic "SCLS", version, encoding, element size and element count) is
+     * followed by frames, each one prefixed by its element count and its length in bytes, and
+     * an empty frame marks the end. Integers of the header and of the frame prefixes are little
+     * endian. Raw elements keep the byte order of the machine that wrote them, which the
+     * encoding records, so they are only read back on a machine with the same byte order.
+     */
+    namespace serial
+    {
+        constexpr char magic[4] = {'S', 'C', 'L', 'S'};
+        constexpr std::uint16_t version = 1;
+        constexpr std::size_t header_bytes = 24;
+        constexpr std::size_t frame_header_bytes = 16;
+        constexpr std::size_t frame_bytes = 64 * 1024; //<! Payload at which a frame is closed
+
+        /// How the elements of a stream are stored.
+        enum encoding : std::uint8_t
+        {
+            raw_little = 1, //<! Object representation, little endian machine
+            raw_big = 2,    //<! Object representation, big endian machine
+            custom = 3      //<! Through serializer<T>
+        };
+
+        /// True when T is stored as its object representation.
+        template <typename T, typename = void>
+        struct is_raw : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_raw<T, std::enable_if_t<serializer<T>::raw>> : std::true_type
+        {
+        };
+
+        /// Encoding of raw elements on this machine.
+        inline encoding native_raw()
+        {
+            const std::uint16_t probe = 1;
+            unsigned char first;
+            std::memcpy(&first, &probe, 1);
+            return first == 1 ? raw_little : raw_big;
+        }
+
+        /// Stores v in the n bytes at p, least significant byte first.
+        inline void store(char *p, std::uint64_t v, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; i++, v >>= 8)
+                p[i] = static_cast<char>(v & 0xff);
+        }
+
+        /// Reads n bytes at p, least significant byte first.
+        inline std::uint64_t fetch(const char *p, std::size_t n)
+        {
+            std::uint64_t v = 0;
+            for (std::size_t i = n; i-- > 0;)
+                v = (v << 8) | static_cast<unsigned char>(p[i]);
+            return v;
+        }
+
+        inline void write_exact(std::ostream &os, const char *p, std::size_t n)
+        {
+            if (!os.write(p, static_cast<std::streamsize>(n)))
+                throw serialization_error("sc::save: the stream failed");
+        }
+
+        inline void read_exact(std::istream &is, char *p, std::size_t n)
+        {
+            if (!is.read(p, static_cast<std::streamsize>(n)))
+                throw serialization_error("sc::load: the stream ended before the list");
+        }
+
+        /// Fills the prefix of a frame of count elements and bytes bytes.
+        inline void frame_header(char *p, std::uint64_t count, std::uint64_t bytes)
+        {
+            store(p, count, 8);
+            store(p + 8, bytes, 8);
+        }
+
+        /// Forward iterator that copies elements out of a buffer of raw elements.
+        template <typename T>
+        class raw_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = T;
+
+            explicit raw_iterator(const char *p) : cur{p} {}
+
+            T operator*() const
+            {
+                // T need not be default-constructible, so its bytes are copied into raw storage.
+                alignas(T) unsigned char value[sizeof(T)];
+                std::memcpy(value, cur, sizeof(T));
+                return *std::launder(reinterpret_cast<T *>(value));
+            }
+
+            raw_iterator &operator++()
+            {
+                cur += sizeof(T);
+                return *this;
+            }
+
+            raw_iterator operator++(int)
+            {
+                raw_iterator temp(*this);
+                cur += sizeof(T);
+                return temp;
+            }
+
+            bool operator==(const raw_iterator &rhs) const { return cur == rhs.cur; }
+            bool operator!=(const raw_iterator &rhs) const { return cur != rhs.cur; }
+
+        private:
+            const char *cur;
+        };
+    } // namespace serial
+
+    /**
+     * Writes seq to os in the format of sc::serial. Raw elements are copied into a buffer a
+     * frame at a time, so os sees one write per 64 KiB; other elements go through serializer<T>.
+     * Throws sc::serialization_error if os fails.
+     */
+    template <typename T, typename Alloc, typename Stats>
+    void save(std::ostream &os, const list<T, Alloc, Stats> &seq)
+    {
+        constexpr bool raw = serial::is_raw<T>::value;
+
+        char header[serial::header_bytes] = {};
+        std::memcpy(header, serial::magic, 4);
+        serial::store(header + 4, serial::version, 2);
+        header[6] = static_cast<char>(raw ? serial::native_raw() : serial::custom);
+        serial::store(header + 8, raw ? sizeof(T) : 0, 4);
+        serial::store(header + 16, seq.size(), 8);
+        serial::write_exact(os, header, sizeof(header));
+
+        auto it = seq.cbegin();
+
+        if constexpr (raw)
+        {
+            const std::size_t per_frame = std::max<std::size_t>(1, serial::frame_bytes / sizeof(T));
+            std::vector<char> frame(serial::frame_header_bytes + std::min<std::size_t>(per_frame, seq.size()) * sizeof(T));
+
+            for (size_type left = seq.size(); left > 0;)
+            {
+                std::size_t count = std::min<std::size_t>(per_frame, left);
+                char *out = frame.data() + serial::frame_header_bytes;
+
+                for (std::size_t i = 0; i < count; i++, ++it, out += sizeof(T))
+                    std::memcpy(out, static_cast<const void *>(&*it), sizeof(T));
+
+                serial::frame_header(frame.data(), count, count * sizeof(T));
+                serial::write_exact(os, frame.data(), serial::frame_header_bytes + count * sizeof(T));
+                left -= count;
+            }
+        }
+        else
+        {
+            byte_writer out;
+            std::uint64_t count = 0;
+            char prefix[serial::frame_header_bytes];
+
+            auto flush = [&]() {
+                serial::frame_header(prefix, count, out.size());
+                serial::write_exact(os, prefix, sizeof(prefix));
+                serial::write_exact(os, out.data(), out.size());
+                out.clear();
+                count = 0;
+            };
+
+            for (; it != seq.cend(); ++it)
+            {
+                serializer<T>::save(out, *it);
+                count++;
+
+                if (out.size() >= serial::frame_bytes)
+                    flush();
+            }
+
+            if (count > 0)
+                flush();
+        }
+
+        char end[serial::frame_header_bytes];
+        serial::frame_header(end, 0, 0);
+        serial::write_exact(os, end, sizeof(end));
+        os.flush();
+    }
+
+    /**
+     * Replaces the contents of seq with a list written by sc::save(). Frames are read one at a
+     * time and the nodes of a frame of raw elements are built in one allocation, so the whole
+     * list never has to be held anywhere else. Throws sc::serialization_error if the stream ends
+     * early or does not match T, in which case seq is left unchanged.
+     */
+    template <typename T, typename Alloc, typename Stats>
+    void load(std::istream &is, list<T, Alloc, Stats> &seq)
+    {
+        constexpr bool raw = serial::is_raw<T>::value;
+
+        char header[serial::header_bytes];
+        serial::read_exact(is, header, sizeof(header));
+
+        if (std::memcmp(header, serial::magic, 4) != 0)
+            throw serialization_error("sc::load: not a serialized sc::list");
+        if (serial::fetch(header + 4, 2) > serial::version)
+            throw serialization_error("sc::load: written by a newer version of the format");
+
+        auto enc = static_cast<serial::encoding>(header[6]);
+        if (raw && enc != serial::native_raw())
+            throw serialization_error("sc::load: elements were not written as raw bytes in this byte order");
+        if (!raw && enc != serial::custom)
+            throw serialization_error("sc::load: elements were not written through sc::serializer");
+        if (serial::fetch(header + 8, 4) != (raw ? sizeof(T) : 0))
+            throw serialization_error("sc::load: elements have a different size");
+
+        const std::uint64_t expected = serial::fetch(header + 16, 8);
+        std::uint64_t loaded = 0;
+        list<T, Alloc, Stats> result(seq.get_allocator());
+        std::vector<char> payload;
+
+        for (;;)
+        {
+            char prefix[serial::frame_header_bytes];
+            serial::read_exact(is, prefix, sizeof(prefix));
+            std::uint64_t count = serial::fetch(prefix, 8);
+            std::uint64_t bytes = serial::fetch(prefix + 8, 8);
+
+            if (count == 0)
+            {
+                if (bytes != 0)
+                    throw serialization_error("sc::load: malformed end of list");
+                break;
+            }
+            if (count > expected - loaded)
+                throw serialization_error("sc::load: more elements than the header announces");
+            if (raw && (count > std::max<std::size_t>(1, serial::frame_bytes / sizeof(T)) || bytes != count * sizeof(T)))
+                throw serialization_error("sc::load: malformed frame");
+            if (bytes > std::numeric_limits<std::size_t>::max())
+                throw serialization_error("sc::load: frame too large");
+
+            // The length is not trusted: the payload only grows as its bytes arrive, so a corrupt
+            // length fails as a stream that ends early instead of as one huge allocation.
+            payload.clear();
+            while (payload.size() < bytes)
+            {
+                std::size_t at = payload.size();
+                std::size_t piece = static_cast<std::size_t>(std::min<std::uint64_t>(bytes - at, serial::frame_bytes));
+                payload.resize(at + piece);
+                serial::read_exact(is, payload.data() + at, piece);
+            }
+            const char *first = payload.data();
+            const char *last = first + payload.size();
+
+            if constexpr (raw)
+            {
+                // One block of nodes per frame, then relinked at the back in O(1).
+                list<T, Alloc, Stats> batch(serial::raw_iterator<T>(first), serial::raw_iterator<T>(last), seq.get_allocator());
+                result.splice(result.end(), batch);
+            }
+            else
+            {
+                byte_reader in(first, last);
+                for (std::uint64_t i = 0; i < count; i++)
+                    result.emplace_back(serializer<T>::load(in));
+
+                if (in.remaining() != 0)
+                    throw serialization_error("sc::load: frame longer than its elements");
+            }
+
+            loaded += count;
+        }
+
+        if (loaded != expected)
+            throw serialization_error("sc::load: fewer elements than the header announces");
+
+        seq = std::move(result);
+    }
+} // namespace sc
+
+#endif
@@ -0,0 +1,218 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+namespace sc
+{
+    /**
+     * @brief Memory resource that hands out fixed-size blocks carved from large chunks.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Requests up to max_block bytes are rounded up to a size class and served from the free list
+     * of that class, or bumped from the current chunk when the free list is empty. Bigger or
+     * over-aligned requests are forwarded to the upstream resource. Chunks are only given back to
+     * the upstream resource by release() or the destructor. This class is not thread-safe.
+     */
+    class slab_resource : public std::pmr::memory_resource
+    {
+    public:
+        static constexpr std::size_t granularity = alignof(std::max_align_t); //<! Size class step and block alignment.
+        static constexpr std::size_t max_block = 256;                         //<! Biggest request served from a slab.
+
+        /// Creates a resource that requests chunks of chunk_size bytes from upstream.
+        explicit slab_resource(std::size_t chunk_size = 64 * 1024,
+                               std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+            : CHUNK_SIZE{chunk_size < min_chunk() ? min_chunk() : chunk_size}, upstream{upstream}, chunks{nullptr}
+        {
+        }
+
+        slab_resource(const slab_resource &) = delete;
+        slab_resource &operator=(const slab_resource &) = delete;
+
+        /// Destructor. Gives every chunk back to the upstream resource.
+        ~slab_resource()
+        {
+            release();
+        }
+
+        /// Gives every chunk back to the upstream resource, invalidating all blocks handed out.
+        void release()
+        {
+            while (chunks != nullptr)
+            {
+                Chunk *nxt = chunks->next;
+                upstream->deallocate(chunks, CHUNK_SIZE, granularity);
+                chunks = nxt;
+            }
+
+            for (auto &cls : classes)
+                cls = SizeClass{};
+        }
+
+        /// Returns the resource chunks are requested from.
+        std::pmr::memory_resource *upstream_resource() const
+        {
+            return upstream;
+        }
+
+    protected:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if (bytes > max_block || alignment > granularity)
+                return upstream->allocate(bytes, alignment);
+
+            SizeClass &cls = classes[class_of(bytes)];
+
+            if (cls.free != nullptr)
+            {
+                FreeBlock *block = cls.free;
+                cls.free = block->next;
+                return block;
+            }
+
+            const std::size_t block_size = (class_of(bytes) + 1) * granularity;
+
+            if (cls.cursor == nullptr || cls.limit - cls.cursor < static_cast<std::ptrdiff_t>(block_size))
+            {
+                char *raw = static_cast<char *>(upstream->allocate(CHUNK_SIZE, granularity));
+                chunks = ::new (raw) Chunk{chunks};
+                cls.cursor = raw + header_size();
+                cls.limit = raw + CHUNK_SIZE;
+            }
+
+            void *block = cls.cursor;
+            cls.cursor += block_size;
+            return block;
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+        {
+            if (bytes > max_block || alignment > granularity)
+            {
+                upstream->deallocate(p, bytes, alignment);
+                return;
+            }
+
+            SizeClass &cls = classes[class_of(bytes)];
+            cls.free = ::new (p) FreeBlock{cls.free};
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+
+    private:
+        /// Link stored inside a block while it sits in a free list.
+        struct FreeBlock
+        {
+            FreeBlock *next;
+        };
+
+        /// Header stored at the start of each chunk so they can be released later.
+        struct Chunk
+        {
+            Chunk *next;
+        };
+
+        /// Free list and bump region of one size class.
+        struct SizeClass
+        {
+            FreeBlock *free = nullptr;
+            char *cursor = nullptr;
+            char *limit = nullptr;
+        };
+
+        static constexpr std::size_t header_size()
+        {
+            return (sizeof(Chunk) + granularity - 1) / granularity * granularity;
+        }
+
+        static constexpr std::size_t min_chunk()
+        {
+            return header_size() + max_block;
+        }
+
+        static constexpr std::size_t class_of(std::size_t bytes)
+        {
+            return bytes == 0 ? 0 : (bytes - 1) / granularity;
+        }
+
+        std::size_t CHUNK_SIZE;
+        std::pmr::memory_resource *upstream;
+        Chunk *chunks;
+        SizeClass classes[max_block / granularity];
+    };
+
+    /**
+     * @brief Allocator that draws its memory from a shared slab_resource.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Copies (and rebinds) share the same resource, so several lists built from copies of one
+     * allocator recycle each other's nodes. A default-constructed allocator owns a fresh resource.
+     */
+    template <typename T>
+    class slab_allocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /// Creates an allocator with its own slab resource.
+        slab_allocator() : res{std::make_shared<slab_resource>()} {}
+
+        /// Creates an allocator that shares the given resource.
+        explicit slab_allocator(std::shared_ptr<slab_resource> r) noexcept : res{std::move(r)} {}
+
+        /// Rebinding constructor, the resource is shared.
+        template <typename U>
+        slab_allocator(const slab_allocator<U> &other) noexcept : res{other.resource()} {}
+
+        /// Allocates storage for n objects of type T.
+        T *allocate(std::size_t n)
+        {
+            if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+
+            return static_cast<T *>(res->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /// Releases storage previously obtained from allocate(n).
+        void deallocate(T *p, std::size_t n) noexcept
+        {
+            res->deallocate(p, n * sizeof(T), alignof(T));
+        }
+
+        /// Returns the shared resource.
+        const std::shared_ptr<slab_resource> &resource() const noexcept
+        {
+            return res;
+        }
+
+        /// Returns true if memory allocated by one allocator can be released by the other.
+        template <typename U>
+        friend bool operator==(const slab_allocator &lhs, const slab_allocator<U> &rhs) noexcept
+        {
+            return lhs.res == rhs.resource();
+        }
+
+        template <typename U>
+        friend bool operator!=(const slab_allocator &lhs, const slab_allocator<U> &rhs) noexcept
+        {
+            return lhs.res != rhs.resource();
+        }
+
+    private:
+        std::shared_ptr<slab_resource> res; //<! Resource shared by every copy.
+    };
+} // namespace sc
+
+#endif
@@ -0,0 +1,681 @@
+#ifndef SMALL_LIST_H
+#define SMALL_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Doubly linked list whose first N nodes live inside the list object.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * The list holds a buffer of N nodes next to its sentinel. New elements take a free node of
+     * the buffer if there is one and a node from Alloc otherwise, so a list that never holds
+     * more than N elements never allocates. Nodes are linked like the ones of sc::list and never
+     * move while they hold an element: inserting or erasing invalidates only the iterators to
+     * the erased elements, whether their nodes are inline or on the heap.
+     *
+     * Moving a list is the exception. Heap nodes are relinked into the new list, so iterators to
+     * them stay valid and refer to the new list, as with sc::list. Inline elements are
+     * move-constructed into nodes of the new list, so iterators to them are invalidated. The
+     * move constructor never allocates: the new list has room inline for every inline element.
+     */
+    template <typename T, size_type N = 8, typename Alloc = std::allocator<T>>
+    class small_list
+    {
+        static_assert(N > 0, "a small_list with no inline nodes is an sc::list");
+
+    private:
+        /// Links shared by the sentinel and the nodes.
+        struct NodeBase
+        {
+            NodeBase *prev; //<! Pointer to the previous node in the list
+            NodeBase *next; //<! Pointer to the next node in the list
+        };
+
+        /// Representation of a node, it contains a data and references to the previous and the next node.
+        struct Node : NodeBase
+        {
+            alignas(T) unsigned char storage[sizeof(T)]; //<! Data field, constructed only while the node is in use
+
+            /// Returns the address of the data field.
+            T *data_ptr() { return reinterpret_cast<T *>(storage); }
+
+            /// Returns the data stored in the node.
+            T &data() { return *std::launder(data_ptr()); }
+            const T &data() const { return *std::launder(reinterpret_cast<const T *>(storage)); }
+        };
+
+        using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+        using node_traits = std::allocator_traits<node_allocator>;
+
+    public:
+        /// Number of nodes kept inside the list object.
+        static constexpr size_type inline_capacity = N;
+
+        /**
+         * @brief Constant iterator of a small list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T *;
+            using reference = const T &;
+
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(current);
+                current = current->next;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(current);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+        protected:
+            NodeBase *current; //<! The node the iterator points to.
+            const_iterator(NodeBase *n) : current(n) {}
+            friend class small_list;
+        };
+
+        /**
+         * @brief Iterator of a small list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a node.
+         */
+        class iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = T *;
+            using reference = T &;
+
+            /// Default constructor that creates an nullptr.
+            iterator() : current{nullptr} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() const { return static_cast<Node *>(current)->data(); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator &operator++()
+            {
+                current = current->next;
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(current);
+                current = current->next;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator &operator--()
+            {
+                current = current->prev;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(current);
+                current = current->prev;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator.
+            friend iterator operator+(iterator it, int n)
+            {
+                for (; n > 0; n--)
+                    it.current = it.current->next;
+                return it;
+            }
+
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            /// Returns the number of elements from rhs to this iterator.
+            size_type operator-(iterator rhs) const
+            {
+                size_type dis = 0;
+                for (; rhs.current != current; rhs.current = rhs.current->next)
+                    dis++;
+                return dis;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return current == rhs.current;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return current != rhs.current;
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current); }
+
+        protected:
+            NodeBase *current; //<! The node the iterator points to.
+            iterator(NodeBase *n) : current(n) {}
+            friend class small_list;
+        };
+
+        // [I] SPECIAL MEMBERS
+
+        /// Default constructor that creates an empty list.
+        small_list() : small_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains the nodes past the first N from alloc.
+        explicit small_list(const Alloc &a) : SIZE{0}, alloc{a}
+        {
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+
+            free_inline = nullptr;
+            for (size_type i = N; i > 0; i--)
+            {
+                slots[i - 1].next = free_inline;
+                free_inline = &slots[i - 1];
+            }
+        }
+
+        /// Constructs the list with count default-inserted instances of T.
+        explicit small_list(size_type count, const Alloc &a = Alloc()) : small_list(a)
+        {
+            for (size_type i = 0; i < count; i++)
+                emplace_back();
+        }
+
+        /// Constructs the list with the contents of the range [first, last).
+        template <typename InputIt>
+        small_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : small_list(a)
+        {
+            while (first != last)
+                emplace_back(*(first++));
+        }
+
+        /// Constructs the list with the contents of the initializer list init.
+        small_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : small_list(ilist.begin(), ilist.end(), a) {}
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other.
+        small_list(const small_list &other)
+            : small_list(other.begin(), other.end(), Alloc(node_traits::select_on_container_copy_construction(other.alloc)))
+        {
+        }
+
+        /// Move constructor. Relinks the heap nodes of other and moves its inline elements, leaving other empty. Never allocates.
+        small_list(small_list &&other) noexcept(std::is_nothrow_move_constructible<T>::value) : small_list(Alloc(other.alloc))
+        {
+            take_nodes(other);
+        }
+
+        /// Destructor
+        ~small_list()
+        {
+            clear();
+        }
+
+        /// Copy the size and values from another list.
+        small_list &operator=(const small_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto &value : other)
+                    emplace_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the elements of other, leaving it empty. Heap nodes are relinked unless the allocators differ and do not propagate.
+        small_list &operator=(small_list &&other) noexcept((node_traits::propagate_on_container_move_assignment::value || node_traits::is_always_equal::value) &&
+                                                    std::is_nothrow_move_constructible<T>::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            if (node_traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = other.alloc;
+                take_nodes(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                take_nodes(other);
+            }
+            else
+            {
+                for (auto &value : other)
+                    emplace_back(std::move(value));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        /// Replaces the contents with those identified by initializer list ilist.
+        small_list &operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            for (const T &value : ilist)
+                emplace_back(value);
+
+            return *this;
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        // [II] ITERATORS
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(sentinel.next);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(&sentinel);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(sentinel.next);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(const_cast<NodeBase *>(&sentinel));
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        /// Returns true if the element at pos is stored inside the list object.
+        bool is_inline(const_iterator pos) const
+        {
+            return in_buffer(pos.current);
+        }
+
+        // [IV] MODIFIERS
+
+        /// Remove all elements from the container.
+        void clear()
+        {
+            NodeBase *curNode = sentinel.next;
+
+            while (curNode != &sentinel)
+            {
+                NodeBase *nxt = curNode->next;
+                destroy_node(node(curNode));
+                curNode = nxt;
+            }
+
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return node(sentinel.next)->data();
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return node(sentinel.next)->data();
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return node(sentinel.prev)->data();
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return node(sentinel.prev)->data();
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            emplace(begin(), value);
+        }
+
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace(begin(), std::move(value));
+        }
+
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            emplace(end(), value);
+        }
+
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace(end(), std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase(iterator(sentinel.prev));
+        }
+
+        /// Adds value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, const T &value)
+        {
+            return emplace(pos, value);
+        }
+
+        /// Moves value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            if (first == last)
+                return pos;
+
+            iterator inserted = emplace(pos, *first);
+            for (++first; first != last; ++first)
+                emplace(pos, *first);
+
+            return inserted;
+        }
+
+        /// Inserts elements from the initializer list ilist before pos and returns an iterator to the first inserted item.
+        iterator insert(iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Constructs an element in place before pos and returns an iterator to it.
+        template <typename... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            Node *newNode = create_node(std::forward<Args>(args)...);
+            NodeBase *at = pos.current;
+
+            newNode->prev = at->prev;
+            newNode->next = at;
+            at->prev->next = newNode;
+            at->prev = newNode;
+            SIZE++;
+
+            return iterator(newNode);
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos)
+        {
+            NodeBase *delNode = pos.current;
+            NodeBase *nextNode = delNode->next;
+
+            delNode->prev->next = nextNode;
+            nextNode->prev = delNode->prev;
+            destroy_node(node(delNode));
+            SIZE--;
+
+            return iterator(nextNode);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            while (first != last)
+                first = erase(first);
+
+            return last;
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const small_list &lhs, const small_list &rhs)
+        {
+            return lhs.SIZE == rhs.SIZE && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const small_list &lhs, const small_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /// Downcasts a link to the node that holds it. Must not be called on the sentinel.
+        static Node *node(NodeBase *link)
+        {
+            return static_cast<Node *>(link);
+        }
+
+        /// Returns true if n is one of the inline nodes.
+        bool in_buffer(const NodeBase *n) const
+        {
+            std::less<const NodeBase *> before;
+            return !before(n, &slots[0]) && before(n, &slots[0] + N);
+        }
+
+        /// Takes a free inline node, or a node from the allocator, and constructs its data from args.
+        template <typename... Args>
+        Node *create_node(Args &&...args)
+        {
+            Node *newNode;
+            if (free_inline != nullptr)
+            {
+                newNode = node(free_inline);
+                free_inline = free_inline->next;
+            }
+            else
+            {
+                newNode = node_traits::allocate(alloc, 1);
+            }
+
+            try
+            {
+                node_traits::construct(alloc, newNode->data_ptr(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                release_node(newNode);
+                throw;
+            }
+
+            return newNode;
+        }
+
+        /// Destroys the data of a node and frees the node.
+        void destroy_node(Node *oldNode)
+        {
+            node_traits::destroy(alloc, oldNode->data_ptr());
+            release_node(oldNode);
+        }
+
+        /// Returns a node with no data to the free inline nodes, or to the allocator.
+        void release_node(Node *oldNode)
+        {
+            if (in_buffer(oldNode))
+            {
+                oldNode->next = free_inline;
+                free_inline = oldNode;
+            }
+            else
+            {
+                node_traits::deallocate(alloc, oldNode, 1);
+            }
+        }
+
+        /**
+         * Moves every element of other to this list, which must be empty, in order, and leaves other
+         * empty. The allocators must be equal. Heap nodes are relinked; inline elements are moved to
+         * inline nodes of this list, which has as many free as other has in use.
+         */
+        void take_nodes(small_list &other)
+        {
+            NodeBase *curNode = other.sentinel.next;
+
+            while (curNode != &other.sentinel)
+            {
+                NodeBase *nxt = curNode->next;
+
+                if (other.in_buffer(curNode))
+                {
+                    emplace_back(std::move(node(curNode)->data()));
+                    other.destroy_node(node(curNode));
+                }
+                else
+                {
+                    curNode->prev = sentinel.prev;
+                    curNode->next = &sentinel;
+                    sentinel.prev->next = curNode;
+                    sentinel.prev = curNode;
+                    SIZE++;
+                }
+
+                // What is left of other stays linked, so an exception leaves both lists whole.
+                other.sentinel.next = nxt;
+                nxt->prev = &other.sentinel;
+                other.SIZE--;
+                curNode = nxt;
+            }
+        }
+
+        size_type SIZE;
+        node_allocator alloc;
+        NodeBase sentinel;     //<! End mark, its next is the first node and its prev is the last one
+        NodeBase *free_inline; //<! Inline nodes with no data, linked through next
+        Node slots[N];         //<! The inline nodes
+    };
+} // namespace sc
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <cstddef>
+#include <ostream>
+
+namespace sc
+{
+    /// Operations whose node hops are recorded by a stats policy.
+    enum class list_op
+    {
+        insert,   //<! insert(), emplace() and their range versions
+        erase,    //<! erase() and pop
+        advance,  //<! iterator + n
+        distance, //<! iterator - iterator
+        splice,   //<! counting the range moved by splice()
+        count     //<! Number of operations, not an operation
+    };
+
+    /// Name of an operation, as printed by list_stats.
+    inline const char *to_string(list_op op)
+    {
+        static const char *const names[] = {"insert", "erase", "advance", "distance", "splice"};
+        return names[static_cast<std::size_t>(op)];
+    }
+
+    /**
+     * @brief Default stats policy of the containers: every hook is empty, so nothing is recorded or stored.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * A policy is a class with these members. The container derives from it, so an empty policy
+     * takes no space, and calls the hooks where the events happen.
+     */
+    struct no_stats
+    {
+        static constexpr bool enabled = false; //<! Whether iterators need to carry a pointer to the policy
+
+        /// A call to the allocator for nodes.
+        void on_allocate() {}
+
+        /// A call to the allocator to give nodes back.
+        void on_deallocate() {}
+
+        /// The size of the container grew to size.
+        void on_grow(std::size_t) {}
+
+        /// An operation followed hops links.
+        void on_hops(list_op, std::size_t) {}
+    };
+
+    /**
+     * @brief Stats policy that counts allocations, frees, peak size and node hops per operation.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Hops are kept in one histogram per operation with power-of-two buckets, so O(n) traversals
+     * (for example iterator + n with large n in a loop) stand out in the upper buckets.
+     */
+    class list_stats
+    {
+    public:
+        static constexpr bool enabled = true;
+
+        /// Number of calls of an operation by number of hops: bucket 0 is 0 hops, bucket k is [2^(k-1), 2^k).
+        struct histogram
+        {
+            static constexpr std::size_t buckets = 8 * sizeof(std::size_t) + 1;
+
+            std::size_t bucket[buckets] = {};
+            std::size_t calls = 0;    //<! Operations recorded
+            std::size_t hops = 0;     //<! Hops of all of them
+            std::size_t max_hops = 0; //<! Hops of the longest one
+
+            /// Records an operation that took h hops.
+            void add(std::size_t h)
+            {
+                std::size_t k = 0;
+                for (std::size_t v = h; v != 0; v >>= 1)
+                    k++;
+
+                bucket[k]++;
+                calls++;
+                hops += h;
+                if (h > max_hops)
+                    max_hops = h;
+            }
+        };
+
+        std::size_t allocations = 0; //<! Calls to the allocator for nodes
+        std::size_t frees = 0;       //<! Calls to the allocator to give nodes back
+        std::size_t peak_size = 0;   //<! Largest size reached
+
+        void on_allocate() { allocations++; }
+
+        void on_deallocate() { frees++; }
+
+        void on_grow(std::size_t size)
+        {
+            if (size > peak_size)
+                peak_size = size;
+        }
+
+        void on_hops(list_op op, std::size_t hops) { per_op[static_cast<std::size_t>(op)].add(hops); }
+
+        /// Returns the histogram of the node hops of op.
+        const histogram &hops(list_op op) const { return per_op[static_cast<std::size_t>(op)]; }
+
+        /// Clears every counter.
+        void reset() { *this = list_stats(); }
+
+        /// Writes the counters and the non-empty buckets of each histogram.
+        friend std::ostream &operator<<(std::ostream &os, const list_stats &s)
+        {
+            os << "allocations " << s.allocations << ", frees " << s.frees << ", peak size " << s.peak_size << '\n';
+
+            for (std::size_t i = 0; i < static_cast<std::size_t>(list_op::count); i++)
+            {
+                const histogram &h = s.per_op[i];
+                if (h.calls == 0)
+                    continue;
+
+                os << to_string(static_cast<list_op>(i)) << ": " << h.calls << " calls, " << h.hops << " hops, max " << h.max_hops << '\n';
+                for (std::size_t k = 0; k < histogram::buckets; k++)
+                {
+                    if (h.bucket[k] == 0)
+                        continue;
+
+                    if (k == 0)
+                        os << "  0: ";
+                    else
+                        os << "  [" << (std::size_t(1) << (k - 1)) << ", " << (std::size_t(1) << (k - 1)) * 2 << "): ";
+                    os << h.bucket[k] << '\n';
+                }
+            }
+
+            return os;
+        }
+
+    private:
+        histogram per_op[static_cast<std::size_t>(list_op::count)];
+    };
+
+    /// Pointer from an iterator to the stats of its container, only stored when the policy records something.
+    template <typename Stats, bool = Stats::enabled>
+    struct stats_ref
+    {
+        Stats *stats;
+
+        stats_ref(Stats *s = nullptr) : stats{s} {}
+
+        /// Records hops on the container, if the iterator knows it.
+        void hops(list_op op, std::size_t n) const
+        {
+            if (stats != nullptr)
+                stats->on_hops(op, n);
+        }
+    };
+
+    template <typename Stats>
+    struct stats_ref<Stats, false>
+    {
+        stats_ref(Stats * = nullptr) {}
+
+        void hops(list_op, std::size_t) const {}
+    };
+} // namespace sc
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sc
+{
+    /**
+     * @brief Fork-join thread pool with one task deque per worker and work stealing.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * run() spreads a batch of tasks over the worker deques and the calling thread helps executing
+     * them until the batch is done. A worker takes tasks from the back of its own deque and, once it
+     * is empty, steals from the front of the others, so uneven tasks still keep every thread busy.
+     */
+    class thread_pool
+    {
+    public:
+        /// Creates a pool with the given number of workers, the calling thread of run() is an extra one.
+        explicit thread_pool(std::size_t workers) : queues(std::max<std::size_t>(workers, 1)), pending{0}, stop{false}
+        {
+            for (std::size_t i = 0; i < workers; i++)
+                threads.emplace_back([this, i] { work(i); });
+        }
+
+        thread_pool(const thread_pool &) = delete;
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        /// Destructor. Waits for the workers to finish.
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mtx);
+                stop = true;
+            }
+            wake.notify_all();
+
+            for (auto &th : threads)
+                th.join();
+        }
+
+        /// Pool shared by the parallel algorithms, one worker less than the hardware threads.
+        static thread_pool &shared()
+        {
+            static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+            return pool;
+        }
+
+        /// Number of threads that execute tasks, counting the caller of run().
+        std::size_t concurrency() const
+        {
+            return threads.size() + 1;
+        }
+
+        /// Calls f(i) for every i in [0, n) and returns when all calls are done. Rethrows the first exception thrown by f.
+        template <typename Function>
+        void run(std::size_t n, Function f)
+        {
+            Batch batch{n};
+
+            for (std::size_t i = 0; i < n; i++)
+            {
+                Queue &q = queues[i % queues.size()];
+                std::lock_guard<std::mutex> lock(q.mtx);
+                q.tasks.push_back([&batch, &f, i] {
+                    try
+                    {
+                        f(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(batch.mtx);
+                        if (!batch.error)
+                            batch.error = std::current_exception();
+                    }
+                    batch.finished();
+                });
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(sleep_mtx);
+                pending.fetch_add(n);
+            }
+            wake.notify_all();
+
+            // Helps until no task is queued, then waits for the ones still running.
+            std::function<void()> task;
+            while (steal(0, task))
+                task();
+
+            std::unique_lock<std::mutex> lock(batch.mtx);
+            batch.done.wait(lock, [&batch] { return batch.left == 0; });
+            if (batch.error)
+                std::rethrow_exception(batch.error);
+        }
+
+    private:
+        /// Tasks of one run() call that are not done yet.
+        struct Batch
+        {
+            std::size_t left;
+            std::mutex mtx;
+            std::condition_variable done;
+            std::exception_ptr error;
+
+            explicit Batch(std::size_t n) : left{n} {}
+
+            /// Notifies while holding the lock, so run() cannot return and destroy the batch before.
+            void finished()
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (--left == 0)
+                    done.notify_all();
+            }
+        };
+
+        /// Task deque of a worker, on its own cache line.
+        struct alignas(64) Queue
+        {
+            std::mutex mtx;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        /// Takes a task from the back of queue i or, failing that, from the front of another queue.
+        bool steal(std::size_t i, std::function<void()> &task)
+        {
+            for (std::size_t k = 0; k < queues.size(); k++)
+            {
+                Queue &q = queues[(i + k) % queues.size()];
+                std::lock_guard<std::mutex> lock(q.mtx);
+
+                if (!q.tasks.empty())
+                {
+                    if (k == 0)
+                    {
+                        task = std::move(q.tasks.back());
+                        q.tasks.pop_back();
+                    }
+                    else
+                    {
+                        task = std::move(q.tasks.front());
+                        q.tasks.pop_front();
+                    }
+
+                    pending.fetch_sub(1);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /// Worker loop: runs tasks while there are any and sleeps otherwise.
+        void work(std::size_t i)
+        {
+            std::function<void()> task;
+
+            for (;;)
+            {
+                if (steal(i, task))
+                {
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(sleep_mtx);
+                wake.wait(lock, [this] { return stop || pending.load() > 0; });
+                if (stop)
+                    return;
+            }
+        }
+
+        std::vector<Queue> queues;
+        std::vector<std::thread> threads;
+        std::atomic<std::size_t> pending; //<! Queued tasks not taken yet
+        std::mutex sleep_mtx;
+        std::condition_variable wake;
+        bool stop;
+    };
+} // namespace sc
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef TRAVERSAL_H
+#define TRAVERSAL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sc
+{
+    /**
+     * Traversal kernels for circular doubly linked lists with a sentinel.
+     *
+     * Following links one at a time stalls on every node that is not cached, since the address
+     * of a node is only known once the previous one has been loaded. The kernels hide part of
+     * that latency in two ways:
+     *
+     * - Independent walks are interleaved. A list of known length is walked from both ends at
+     *   once, meeting in the middle, and equal() walks both lists that way: two (or four) chains
+     *   of loads are in flight instead of one.
+     * - Each walk predicts the address of the nodes ahead from the distance between the last
+     *   nodes it visited. Nodes allocated together (or by a slab or bump allocator) often follow
+     *   each other in memory, and then the prediction brings them in prefetch_distance nodes
+     *   early. Prefetches are only issued while the distance stays the same, so a list whose
+     *   nodes are scattered pays for one subtraction per node and nothing else.
+     *
+     * A Link is any type with prev and next pointers to Link; head is the sentinel, whose next is
+     * the first node and whose prev is the last one, and n is the number of nodes. value(link)
+     * returns the element of a node. Except in find_first_if(), predicates are called on the
+     * elements in no particular order and possibly past the first match, so they must not have
+     * side effects.
+     */
+    namespace traversal
+    {
+        constexpr std::size_t prefetch_distance = 8; //<! Nodes ahead of a walk that are prefetched
+
+        /// Asks for the cache line at address, without waiting for it. Never faults, even on an invalid address.
+        inline void prefetch(std::uintptr_t address)
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(reinterpret_cast<const void *>(address), 0, 3);
+#else
+            (void)address;
+#endif
+        }
+
+        /// Guesses the address of the node prefetch_distance steps ahead of a walk from the stride of its last steps.
+        class stride_predictor
+        {
+        public:
+            explicit stride_predictor(const void *start) : last{reinterpret_cast<std::uintptr_t>(start)} {}
+
+            /// Records that the walk reached node, prefetching ahead of it if the stride did not change.
+            void step(const void *node)
+            {
+                std::uintptr_t address = reinterpret_cast<std::uintptr_t>(node);
+                std::uintptr_t delta = address - last;
+
+                // Unsigned arithmetic, so walks towards lower addresses wrap around to the right place.
+                if (delta == stride)
+                    prefetch(address + delta * prefetch_distance);
+
+                stride = delta;
+                last = address;
+            }
+
+        private:
+            std::uintptr_t last;       //<! Address of the last node visited
+            std::uintptr_t stride = 0; //<! Distance between the last two nodes visited
+        };
+
+        /// Returns the first node of the n nodes after head whose element satisfies pred, or head if there is none.
+        template <typename Link, typename Value, typename Pred>
+        Link *find_if(Link *head, std::size_t n, Value value, Pred pred)
+        {
+            Link *front = head->next;
+            Link *back = head->prev;
+            Link *found = head; // First match of the back half seen so far
+            stride_predictor ahead(front), behind(back);
+
+            // The front walk may return on its first match; the back walk can only narrow down the back half.
+            for (std::size_t i = n / 2; i > 0; i--)
+            {
+                if (pred(value(front)))
+                    return front;
+                if (pred(value(back)))
+                    found = back;
+
+                front = front->next;
+                back = back->prev;
+                ahead.step(front);
+                behind.step(back);
+            }
+
+            if (n % 2 == 1 && pred(value(front)))
+                return front;
+
+            return found;
+        }
+
+        /**
+         * Returns the first node after head whose element satisfies pred, or head if there is none.
+         * Unlike find_if(), pred is called in list order and never past the first match, so it may
+         * have side effects; only the front is walked.
+         */
+        template <typename Link, typename Value, typename Pred>
+        Link *find_first_if(Link *head, Value value, Pred pred)
+        {
+            Link *cur = head->next;
+            stride_predictor ahead(cur);
+
+            while (cur != head && !pred(value(cur)))
+            {
+                cur = cur->next;
+                ahead.step(cur);
+            }
+
+            return cur;
+        }
+
+        /// Returns the number of the n nodes after head whose element satisfies pred.
+        template <typename Link, typename Value, typename Pred>
+        std::size_t count_if(Link *head, std::size_t n, Value value, Pred pred)
+        {
+            Link *front = head->next;
+            Link *back = head->prev;
+            stride_predictor ahead(front), behind(back);
+            std::size_t total = 0;
+
+            for (std::size_t i = n / 2; i > 0; i--)
+            {
+                total += pred(value(front)) ? 1 : 0;
+                total += pred(value(back)) ? 1 : 0;
+
+                front = front->next;
+                back = back->prev;
+                ahead.step(front);
+                behind.step(back);
+            }
+
+            if (n % 2 == 1)
+                total += pred(value(front)) ? 1 : 0;
+
+            return total;
+        }
+
+        /// Calls f on the element of each of the n nodes after head, in no particular order.
+        template <typename Link, typename Value, typename Function>
+        void for_each(Link *head, std::size_t n, Value value, Function f)
+        {
+            Link *front = head->next;
+            Link *back = head->prev;
+            stride_predictor ahead(front), behind(back);
+
+            for (std::size_t i = n / 2; i > 0; i--)
+            {
+                f(value(front));
+                f(value(back));
+
+                front = front->next;
+                back = back->prev;
+                ahead.step(front);
+                behind.step(back);
+            }
+
+            if (n % 2 == 1)
+                f(value(front));
+        }
+
+        /// Returns true if the n nodes after lhs hold elements equal to those of the n nodes after rhs, in order.
+        template <typename Link, typename Value, typename Equal>
+        bool equal(const Link *lhs, const Link *rhs, std::size_t n, Value value, Equal eq)
+        {
+            const Link *lf = lhs->next, *rf = rhs->next;
+            const Link *lb = lhs->prev, *rb = rhs->prev;
+            stride_predictor lahead(lf), rahead(rf), lbehind(lb), rbehind(rb);
+
+            // Four independent chains; any mismatch decides, so both halves may stop early.
+            for (std::size_t i = n / 2; i > 0; i--)
+            {
+                if (!eq(value(lf), value(rf)) || !eq(value(lb), value(rb)))
+                    return false;
+
+                lf = lf->next;
+                rf = rf->next;
+                lb = lb->prev;
+                rb = rb->prev;
+                lahead.step(lf);
+                rahead.step(rf);
+                lbehind.step(lb);
+                rbehind.step(rb);
+            }
+
+            return n % 2 == 0 || eq(value(lf), value(rf));
+        }
+
+        /**
+         * Returns true if the n nodes after lhs come before the m nodes after rhs in lexicographical
+         * order. The first difference decides, so only the fronts are walked, side by side.
+         */
+        template <typename Link, typename Value, typename Less>
+        bool lexicographical_compare(const Link *lhs, std::size_t n, const Link *rhs, std::size_t m, Value value, Less less)
+        {
+            const Link *l = lhs->next, *r = rhs->next;
+            stride_predictor lahead(l), rahead(r);
+
+            for (std::size_t i = n < m ? n : m; i > 0; i--)
+            {
+                if (less(value(l), value(r)))
+                    return true;
+                if (less(value(r), value(l)))
+                    return false;
+
+                l = l->next;
+                r = r->next;
+                lahead.step(l);
+                rahead.step(r);
+            }
+
+            return n < m;
+        }
+    } // namespace traversal
+} // namespace sc
+
+#endif
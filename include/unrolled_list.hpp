@@ -0,0 +1,779 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "list.hpp"
+
+namespace sc
+{
+    /**
+     * @brief Doubly linked list that stores several elements per node.
+     * @author Eduardo Sarmento & Victor Vieira
+     *
+     * Each chunk is a whole number of cache lines (at least ChunkLines) and keeps its elements
+     * packed at the front of its storage, so a scan walks contiguous memory and follows one link
+     * per chunk instead of one per element. Inserting into a full chunk splits it in two and
+     * erasing merges a chunk with its successor when both fit in three quarters of one, so
+     * elements never get a node of their own.
+     *
+     * The iterators behave like the ones of sc::list, but inserting or erasing invalidates the
+     * iterators to the chunks involved (the returned iterator is always valid).
+     *
+     * Splits, merges and shifts move elements between slots, so T must be nothrow move
+     * constructible; only the construction of the new element may throw.
+     */
+    template <typename T, typename Alloc = std::allocator<T>, std::size_t ChunkLines = 4>
+    class unrolled_list
+    {
+        static_assert(std::is_nothrow_move_constructible<T>::value, "elements are relocated between slots, which must not throw");
+
+    private:
+        static constexpr std::size_t cache_line = 64;
+
+        /// Links and element count of a chunk, also used by the sentinel.
+        struct ChunkBase
+        {
+            ChunkBase *prev;  //<! Pointer to the previous chunk in the list
+            ChunkBase *next;  //<! Pointer to the next chunk in the list
+            size_type count; //<! Number of elements stored in the chunk
+        };
+
+        static constexpr std::size_t header_bytes = (sizeof(ChunkBase) + alignof(T) - 1) / alignof(T) * alignof(T);
+        static constexpr std::size_t lines = ChunkLines > (header_bytes + 2 * sizeof(T) + cache_line - 1) / cache_line
+                                                 ? ChunkLines
+                                                 : (header_bytes + 2 * sizeof(T) + cache_line - 1) / cache_line;
+
+    public:
+        /// Number of elements that fit in one chunk.
+        static constexpr size_type chunk_capacity = (lines * cache_line - header_bytes) / sizeof(T);
+
+    private:
+        /// Chunk of elements, aligned to a cache line.
+        struct alignas(cache_line) Chunk : ChunkBase
+        {
+            alignas(T) unsigned char storage[chunk_capacity * sizeof(T)]; //<! Elements [0, count) are constructed
+
+            /// Returns the address of the i-th slot.
+            T *slot(size_type i) { return reinterpret_cast<T *>(storage) + i; }
+
+            /// Returns the i-th element.
+            T &at(size_type i) { return *std::launder(slot(i)); }
+        };
+
+        using chunk_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<Chunk>;
+        using chunk_traits = std::allocator_traits<chunk_allocator>;
+
+    public:
+        /**
+         * @brief Constant iterator of an unrolled list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a chunk and the index of the element inside it.
+         */
+        class const_iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            const_iterator() : current{nullptr}, index{0} {}
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Chunk *>(current)->at(index); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            const_iterator &operator++()
+            {
+                if (++index == current->count)
+                {
+                    current = current->next;
+                    index = 0;
+                }
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            const_iterator operator++(int)
+            {
+                const_iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            const_iterator &operator--()
+            {
+                if (index == 0)
+                {
+                    current = current->prev;
+                    index = current->count;
+                }
+                --index;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            const_iterator operator--(int)
+            {
+                const_iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const const_iterator &rhs) const
+            {
+                return current == rhs.current && index == rhs.index;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const const_iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+        protected:
+            ChunkBase *current; //<! The chunk that holds the element.
+            size_type index;    //<! Position of the element inside the chunk.
+            const_iterator(ChunkBase *c, size_type i) : current(c), index(i) {}
+            friend class unrolled_list;
+        };
+
+        /**
+         * @brief Iterator of an unrolled list.
+         * @author Eduardo Sarmento & Victor Vieira
+         *
+         * Encapsulates a pointer to a chunk and the index of the element inside it.
+         */
+        class iterator
+        {
+        public:
+            /// Default constructor that creates an nullptr.
+            iterator() : current(nullptr), index{0} {}
+
+            /// Return a const reference to the object located at the position pointed by the iterator.
+            const T &operator*() const { return static_cast<Chunk *>(current)->at(index); }
+
+            /// Return a reference to the object located at the position pointed by the iterator.
+            T &operator*() { return static_cast<Chunk *>(current)->at(index); }
+
+            /// Advances the iterator to the next location within the list and returns itself after that.
+            iterator operator++()
+            {
+                if (++index == current->count)
+                {
+                    current = current->next;
+                    index = 0;
+                }
+                return *this;
+            }
+
+            /// Advances the iterator to the next location within the list and returns itself before that.
+            iterator operator++(int)
+            {
+                iterator temp(*this);
+                ++*this;
+                return temp;
+            }
+
+            /// Advances to the n-th successor of the iterator, skipping whole chunks when possible.
+            friend iterator operator+(int n, iterator it)
+            {
+                return it + n;
+            }
+
+            friend iterator operator+(iterator it, int n)
+            {
+                size_type left = n;
+
+                while (left > 0 && left >= it.current->count - it.index)
+                {
+                    left -= it.current->count - it.index;
+                    it.current = it.current->next;
+                    it.index = 0;
+                }
+                it.index += left;
+
+                return it;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself after that.
+            iterator operator--()
+            {
+                if (index == 0)
+                {
+                    current = current->prev;
+                    index = current->count;
+                }
+                --index;
+                return *this;
+            }
+
+            /// Backs the iterator to the previous location within the list and returns itself before that.
+            iterator operator--(int)
+            {
+                iterator temp(*this);
+                --*this;
+                return temp;
+            }
+
+            /// Returns the distance between the elements (not between the adresses).
+            size_type operator-(iterator rhs)
+            {
+                size_type dis = 0;
+
+                while (rhs.current != current)
+                {
+                    dis += rhs.current->count - rhs.index;
+                    rhs.current = rhs.current->next;
+                    rhs.index = 0;
+                }
+
+                return dis + index - rhs.index;
+            }
+
+            /// Returns true if both iterators refer to same location within the list, and false otherwise.
+            bool operator==(const iterator &rhs) const
+            {
+                return current == rhs.current && index == rhs.index;
+            }
+
+            /// Returns true if both iterators refer to differents location within the list, and false otherwise.
+            bool operator!=(const iterator &rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /// Converts to a constant iterator to the same location.
+            operator const_iterator() const { return const_iterator(current, index); }
+
+        protected:
+            ChunkBase *current; //<! The chunk that holds the element.
+            size_type index;    //<! Position of the element inside the chunk.
+            iterator(ChunkBase *c, size_type i) : current(c), index(i) {}
+            friend class unrolled_list;
+        };
+
+    public:
+        /// Default constructor that creates an empty list.
+        unrolled_list() : unrolled_list(Alloc()) {}
+
+        /// Constructs an empty list that obtains its chunks from alloc.
+        explicit unrolled_list(const Alloc &a) : SIZE{0}, alloc{a}
+        {
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+            sentinel.count = 0;
+        }
+
+        /// Constructs the list with count default-inserted instances of T.
+        explicit unrolled_list(size_type count, const Alloc &a = Alloc()) : unrolled_list(a)
+        {
+            for (size_type i = 0; i < count; i++)
+                emplace_back();
+        }
+
+        /// Constructs the list with the contents of the range [first, last).
+        template <typename InputIt>
+        unrolled_list(InputIt first, InputIt last, const Alloc &a = Alloc()) : unrolled_list(a)
+        {
+            while (first != last)
+                emplace_back(*(first++));
+        }
+
+        /// Constructs the list with the contents of the initializer list init.
+        unrolled_list(std::initializer_list<T> ilist, const Alloc &a = Alloc()) : unrolled_list(ilist.begin(), ilist.end(), a) {}
+
+        /// Copy constructor. Constructs the list with the deep copy of the contents of other.
+        unrolled_list(const unrolled_list &other)
+            : unrolled_list(other.begin(), other.end(), Alloc(chunk_traits::select_on_container_copy_construction(other.alloc)))
+        {
+        }
+
+        /// Move constructor. Takes over the chunks of other in O(1), leaving other empty.
+        unrolled_list(unrolled_list &&other) noexcept : unrolled_list(Alloc(other.alloc))
+        {
+            take_chunks(other);
+        }
+
+        /// Destructor
+        ~unrolled_list()
+        {
+            clear();
+        }
+
+        /// Copy the size and values from another list.
+        unrolled_list &operator=(const unrolled_list &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto &value : other)
+                    emplace_back(value);
+            }
+
+            return *this;
+        }
+
+        /// Takes over the chunks of other, leaving it empty.
+        unrolled_list &operator=(unrolled_list &&other) noexcept(chunk_traits::propagate_on_container_move_assignment::value || chunk_traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            clear();
+
+            if (chunk_traits::propagate_on_container_move_assignment::value)
+            {
+                alloc = other.alloc;
+                take_chunks(other);
+            }
+            else if (alloc == other.alloc)
+            {
+                take_chunks(other);
+            }
+            else
+            {
+                for (auto &value : other)
+                    emplace_back(std::move(value));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        /// Replaces the contents with those identified by initializer list ilist.
+        unrolled_list &operator=(std::initializer_list<T> ilist)
+        {
+            clear();
+            for (const T &value : ilist)
+                emplace_back(value);
+
+            return *this;
+        }
+
+        /// Returns a copy of the allocator associated with the list.
+        Alloc get_allocator() const
+        {
+            return Alloc(alloc);
+        }
+
+        // [II ITERATORS]
+
+        /// Returns an iterator pointing to the first item in the list.
+        iterator begin()
+        {
+            return iterator(sentinel.next, 0);
+        }
+
+        /// Returns an iterator pointing to the end mark in the list.
+        iterator end()
+        {
+            return iterator(&sentinel, 0);
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator begin() const
+        {
+            return cbegin();
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator end() const
+        {
+            return cend();
+        }
+
+        /// Returns a constant iterator pointing to the first item in the list.
+        const_iterator cbegin() const
+        {
+            return const_iterator(sentinel.next, 0);
+        }
+
+        /// Returns a constant iterator pointing to the end mark in the list.
+        const_iterator cend() const
+        {
+            return const_iterator(const_cast<ChunkBase *>(&sentinel), 0);
+        }
+
+        // [III] CAPACITY
+
+        /// Return the number of elements in the container.
+        size_type size() const
+        {
+            return SIZE;
+        }
+
+        /// Returns true if the container contains no elements, and false otherwise.
+        bool empty() const
+        {
+            return SIZE == 0;
+        }
+
+        // [IV] MODIFIERS
+
+        /// Remove all elements from the container.
+        void clear()
+        {
+            ChunkBase *cur = sentinel.next;
+
+            while (cur != &sentinel)
+            {
+                ChunkBase *nxt = cur->next;
+                destroy_chunk(chunk(cur));
+                cur = nxt;
+            }
+
+            sentinel.prev = &sentinel;
+            sentinel.next = &sentinel;
+            SIZE = 0;
+        }
+
+        /// Returns the object at the front of the list.
+        T &front()
+        {
+            return chunk(sentinel.next)->at(0);
+        }
+
+        /// Returns the object at the front of the list.
+        const T &front() const
+        {
+            return chunk(sentinel.next)->at(0);
+        }
+
+        /// Returns the object at the end of the list.
+        T &back()
+        {
+            return chunk(sentinel.prev)->at(sentinel.prev->count - 1);
+        }
+
+        /// Returns the object at the end of the list.
+        const T &back() const
+        {
+            return chunk(sentinel.prev)->at(sentinel.prev->count - 1);
+        }
+
+        /// Adds value to the front of the list.
+        void push_front(const T &value)
+        {
+            emplace(begin(), value);
+        }
+
+        /// Moves value to the front of the list.
+        void push_front(T &&value)
+        {
+            emplace(begin(), std::move(value));
+        }
+
+        /// Constructs an element in place at the front of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_front(Args &&...args)
+        {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+
+        /// Adds value to the back of the list.
+        void push_back(const T &value)
+        {
+            emplace_back(value);
+        }
+
+        /// Moves value to the back of the list.
+        void push_back(T &&value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        /// Constructs an element in place at the back of the list and returns a reference to it.
+        template <typename... Args>
+        T &emplace_back(Args &&...args)
+        {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+
+        /// Removes value of the front of the list.
+        void pop_front()
+        {
+            erase(begin());
+        }
+
+        /// Removes value of the back of the list.
+        void pop_back()
+        {
+            erase(iterator(sentinel.prev, sentinel.prev->count - 1));
+        }
+
+        /// Adds value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, const T &value)
+        {
+            return emplace(pos, value);
+        }
+
+        /// Moves value into the list before pos and returns an iterator to the inserted item.
+        iterator insert(iterator pos, T &&value)
+        {
+            return emplace(pos, std::move(value));
+        }
+
+        /// Inserts elements from the range [first; last) before pos and returns an iterator to the first inserted item.
+        template <class InItr>
+        iterator insert(iterator pos, InItr first, InItr last)
+        {
+            size_type inserted = 0;
+
+            for (; first != last; ++first, ++inserted)
+            {
+                pos = emplace(pos, *first);
+                ++pos;
+            }
+
+            // A split may have moved earlier insertions, so walk back from the element after them.
+            while (inserted-- > 0)
+                --pos;
+
+            return pos;
+        }
+
+        /// Inserts elements from the initializer list ilist before pos and returns an iterator to the first inserted item.
+        iterator insert(iterator pos, std::initializer_list<T> ilist)
+        {
+            return insert(pos, ilist.begin(), ilist.end());
+        }
+
+        /// Constructs an element in place before pos and returns an iterator to it.
+        template <typename... Args>
+        iterator emplace(iterator pos, Args &&...args)
+        {
+            ChunkBase *target = pos.current;
+            size_type index = pos.index;
+
+            if (target == &sentinel || (index == 0 && target->prev != &sentinel && target->prev->count < chunk_capacity))
+            {
+                // Append to the previous chunk when it has room, otherwise start a new one.
+                target = target->prev;
+                if (target == &sentinel || target->count == chunk_capacity)
+                    target = link_after(target, create_chunk());
+                index = target->count;
+            }
+            else if (target->count == chunk_capacity)
+            {
+                ChunkBase *upper = split(chunk(target));
+                if (index > target->count)
+                {
+                    index -= target->count;
+                    target = upper;
+                }
+            }
+
+            Chunk *c = chunk(target);
+            shift_right(c, index);
+
+            try
+            {
+                chunk_traits::construct(alloc, c->slot(index), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                // The elements after the hole sit one slot up, so close it over count + 1 slots.
+                c->count++;
+                shift_left(c, index);
+                c->count--;
+
+                // Only a chunk created for this element can be empty.
+                if (c->count == 0)
+                {
+                    unlink(c);
+                    destroy_chunk(c);
+                }
+                throw;
+            }
+
+            c->count++;
+            SIZE++;
+
+            return iterator(target, index);
+        }
+
+        /// Removes the object at position pos and returns an iterator to the element that follows pos before the call.
+        iterator erase(iterator pos)
+        {
+            Chunk *c = chunk(pos.current);
+            size_type index = pos.index;
+
+            chunk_traits::destroy(alloc, c->slot(index));
+            shift_left(c, index);
+            c->count--;
+            SIZE--;
+
+            if (c->count == 0)
+            {
+                ChunkBase *nxt = c->next;
+                unlink(c);
+                destroy_chunk(c);
+                return iterator(nxt, 0);
+            }
+
+            // Merge with the successor when both fit in three quarters of a chunk, so that a split
+            // followed by an erase does not merge right back.
+            ChunkBase *nxt = c->next;
+            if (nxt != &sentinel && c->count + nxt->count <= chunk_capacity * 3 / 4)
+                merge_next(c);
+
+            if (index == c->count)
+                return iterator(c->next, 0);
+
+            return iterator(c, index);
+        }
+
+        /// Removes elements in the range [first; last).
+        iterator erase(iterator first, iterator last)
+        {
+            for (size_type n = last - first; n > 0; n--)
+                first = erase(first);
+
+            return first;
+        }
+
+        /// Returns true if each element of a list is equal to another.
+        friend bool operator==(const unrolled_list &lhs, const unrolled_list &rhs)
+        {
+            if (lhs.SIZE != rhs.SIZE)
+                return false;
+
+            for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+            {
+                if (*l != *r)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /// Returns true if, at least, one element of a list is different to another.
+        friend bool operator!=(const unrolled_list &lhs, const unrolled_list &rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        static Chunk *chunk(ChunkBase *link)
+        {
+            return static_cast<Chunk *>(link);
+        }
+
+        static const Chunk *chunk(const ChunkBase *link)
+        {
+            return static_cast<const Chunk *>(link);
+        }
+
+        /// Allocates an empty chunk.
+        Chunk *create_chunk()
+        {
+            Chunk *c = chunk_traits::allocate(alloc, 1);
+            c->count = 0;
+            return c;
+        }
+
+        /// Destroys the elements of a chunk and gives its memory back to the allocator.
+        void destroy_chunk(Chunk *c)
+        {
+            for (size_type i = 0; i < c->count; i++)
+                chunk_traits::destroy(alloc, c->slot(i));
+            chunk_traits::deallocate(alloc, c, 1);
+        }
+
+        /// Links c right after pos.
+        ChunkBase *link_after(ChunkBase *pos, ChunkBase *c)
+        {
+            c->prev = pos;
+            c->next = pos->next;
+            pos->next->prev = c;
+            pos->next = c;
+            return c;
+        }
+
+        /// Unlinks c from the list without destroying it.
+        static void unlink(ChunkBase *c)
+        {
+            c->prev->next = c->next;
+            c->next->prev = c->prev;
+        }
+
+        /// Moves the upper half of a full chunk to a new chunk linked after it and returns the new chunk.
+        ChunkBase *split(Chunk *c)
+        {
+            Chunk *upper = create_chunk();
+            size_type keep = c->count / 2;
+
+            for (size_type i = keep; i < c->count; i++)
+                relocate(c->slot(i), upper->slot(i - keep));
+
+            upper->count = c->count - keep;
+            c->count = keep;
+
+            return link_after(c, upper);
+        }
+
+        /// Appends the elements of the chunk after c to c and frees that chunk.
+        void merge_next(Chunk *c)
+        {
+            Chunk *nxt = chunk(c->next);
+
+            for (size_type i = 0; i < nxt->count; i++)
+                relocate(nxt->slot(i), c->slot(c->count + i));
+
+            c->count += nxt->count;
+            nxt->count = 0;
+            unlink(nxt);
+            destroy_chunk(nxt);
+        }
+
+        /// Opens a hole at index by moving the elements [index, count) one slot up.
+        void shift_right(Chunk *c, size_type index)
+        {
+            for (size_type i = c->count; i > index; i--)
+                relocate(c->slot(i - 1), c->slot(i));
+        }
+
+        /// Closes the hole at index by moving the elements (index, count] one slot down.
+        void shift_left(Chunk *c, size_type index)
+        {
+            for (size_type i = index; i + 1 < c->count; i++)
+                relocate(c->slot(i + 1), c->slot(i));
+        }
+
+        /// Move-constructs *to from *from and destroys *from.
+        void relocate(T *from, T *to)
+        {
+            chunk_traits::construct(alloc, to, std::move(*std::launder(from)));
+            chunk_traits::destroy(alloc, std::launder(from));
+        }
+
+        /// Moves every chunk of other to this list, which must be empty, and leaves other empty.
+        void take_chunks(unrolled_list &other)
+        {
+            if (other.SIZE == 0)
+                return;
+
+            sentinel.next = other.sentinel.next;
+            sentinel.prev = other.sentinel.prev;
+            sentinel.next->prev = &sentinel;
+            sentinel.prev->next = &sentinel;
+            SIZE = other.SIZE;
+
+            other.sentinel.next = &other.sentinel;
+            other.sentinel.prev = &other.sentinel;
+            other.SIZE = 0;
+        }
+
+        size_type SIZE;
+        chunk_allocator alloc;
+        ChunkBase sentinel; //<! End mark, its next is the first chunk and its prev is the last one
+    };
+} // namespace sc
+
+#endif
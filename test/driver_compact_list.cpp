@@ -0,0 +1,197 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdint>
+#include <cstdlib>  // rand()
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../include/compact_list.hpp"
+
+// Returns true if the list holds the same elements as the model, in both directions.
+template <typename List, typename Model>
+bool same(const List &seq, const Model &model)
+{
+    if (seq.size() != model.size())
+        return false;
+
+    auto m = model.begin();
+    for (auto it = seq.begin(); it != seq.end(); ++it, ++m)
+    {
+        if (*it != *m)
+            return false;
+    }
+
+    auto r = model.end();
+    for (auto it = seq.end(); it != seq.begin();)
+    {
+        if (*--it != *--r)
+            return false;
+    }
+
+    return true;
+}
+
+// The compact list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": constructors, assignment and capacity.\n";
+        sc::compact_list<int> empty;
+        assert(empty.empty() && empty.capacity() == 0 && empty.begin() == empty.end());
+
+        sc::compact_list<int> seq{1, 2, 3, 4, 5};
+        assert(same(seq, std::vector<int>{1, 2, 3, 4, 5}));
+        assert(seq.capacity() >= 5);
+
+        sc::compact_list<int> copy(seq);
+        assert(copy == seq);
+
+        // Moving takes over the array and cannot throw.
+        static_assert(std::is_nothrow_move_constructible_v<sc::compact_list<int>>, "move constructor must be noexcept");
+        static_assert(std::is_nothrow_move_assignable_v<sc::compact_list<int>>, "move assignment must be noexcept");
+        sc::compact_list<int> moved(std::move(copy));
+        assert(copy.empty() && copy.capacity() == 0 && moved == seq);
+
+        copy = moved;
+        moved = {7, 8};
+        assert(same(moved, std::vector<int>{7, 8}));
+        moved = std::move(copy);
+        assert(moved == seq);
+        assert(moved != sc::compact_list<int>(5));
+
+        sc::compact_list<std::string> words(3);
+        assert(words.size() == 3 && words.front().empty());
+
+        seq.reserve(1000);
+        assert(seq.capacity() >= 1000);
+        assert(same(seq, std::vector<int>{1, 2, 3, 4, 5}));
+
+        seq.clear();
+        assert(seq.empty() && seq.capacity() >= 1000);
+
+        bool thrown = false;
+        try
+        {
+            sc::compact_list<char, std::allocator<char>, std::uint8_t> tiny;
+            for (auto i{0}; i < 300; ++i)
+                tiny.push_back('x');
+        }
+        catch (const std::length_error &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+        assert((sc::compact_list<char, std::allocator<char>, std::uint8_t>::max_size() == 254));
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": iterators survive relocation.\n";
+        sc::compact_list<std::string> seq;
+        seq.push_back("first");
+        auto first = seq.begin();
+        auto last = seq.insert(seq.end(), "last");
+        size_type cap = seq.capacity();
+
+        while (seq.capacity() == cap)
+            seq.insert(last, "middle");
+
+        assert(*first == "first" && *last == "last");
+        assert(++first != last && *first == "middle");
+
+        // Growing while the argument is an element of the list itself.
+        sc::compact_list<std::string> self{"a"};
+        for (auto i{0}; i < 100; ++i)
+            self.push_back(self.front());
+        for (auto &s : self)
+            assert(s == "a");
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": random insert() and erase() against std::list.\n";
+        sc::compact_list<std::unique_ptr<int>> seq;
+        std::list<int> model;
+        std::srand(13);
+
+        for (auto i{0}; i < 20000; ++i)
+        {
+            size_type pos = model.empty() ? 0 : std::rand() % (model.size() + 1);
+            auto it = seq.begin() + pos;
+            auto m = std::next(model.begin(), pos);
+
+            if (model.empty() || std::rand() % 5 < 3 || m == model.end())
+            {
+                it = seq.insert(it, std::make_unique<int>(i));
+                model.insert(m, i);
+                assert(**it == i);
+            }
+            else
+            {
+                it = seq.erase(it);
+                m = model.erase(m);
+                assert((it == seq.end()) == (m == model.end()));
+            }
+        }
+
+        assert(seq.size() == model.size());
+        auto m = model.begin();
+        for (auto &p : seq)
+            assert(*p == *m++);
+
+        // Freed slots are reused before the array grows.
+        size_type cap = seq.capacity();
+        for (auto i{0}; i < 100; ++i)
+            seq.pop_front();
+        for (auto i{0}; i < 100; ++i)
+            seq.push_back(std::make_unique<int>(i));
+        assert(seq.capacity() == cap);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push, pop and ranges.\n";
+        sc::compact_list<int> seq;
+        std::list<int> model;
+
+        for (auto i{0}; i < 50; ++i)
+        {
+            seq.push_back(i);
+            seq.push_front(-i);
+            model.push_back(i);
+            model.push_front(-i);
+        }
+        seq.pop_back();
+        seq.pop_front();
+        model.pop_back();
+        model.pop_front();
+        assert(same(seq, model));
+        assert(seq.front() == model.front() && seq.back() == model.back());
+
+        std::vector<int> extra{100, 101, 102};
+        auto it = seq.insert(seq.begin() + 10, extra.begin(), extra.end());
+        model.insert(std::next(model.begin(), 10), extra.begin(), extra.end());
+        assert(*it == 100 && same(seq, model));
+
+        it = seq.insert(seq.end(), {7, 8});
+        model.insert(model.end(), {7, 8});
+        assert(*it == 7 && same(seq, model));
+
+        it = seq.erase(seq.begin() + 5, seq.begin() + 20);
+        model.erase(std::next(model.begin(), 5), std::next(model.begin(), 20));
+        assert(*it == *std::next(model.begin(), 5) && same(seq, model));
+        assert(seq.begin() + 5 == it && it - seq.begin() == 5);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <atomic>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/concurrent_list.hpp"
+
+// Runs f(t) on n threads and waits for all of them.
+template <typename Function>
+void run_threads(int n, Function f)
+{
+    std::vector<std::thread> pool;
+    for (auto t{0}; t < n; ++t)
+        pool.emplace_back(f, t);
+    for (auto &th : pool)
+        th.join();
+}
+
+/// Counts the nodes freed by an epoch_domain.
+struct reclaimed
+{
+    static inline std::atomic<int> count{0};
+    static void deleter(void *p)
+    {
+        delete static_cast<int *>(p);
+        count++;
+    }
+};
+
+// The concurrent list driver.
+int main(void)
+{
+    auto n_unit{0};
+    const int n_threads = 8;
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": insert(), erase() and contains().\n";
+        sc::concurrent_list<int> seq;
+        assert(seq.empty());
+
+        assert(seq.insert(3));
+        assert(seq.insert(1));
+        assert(seq.insert(2));
+        assert(not seq.insert(2));
+        assert(seq.size() == 3);
+
+        assert(seq.contains(1));
+        assert(not seq.contains(4));
+
+        assert(seq.erase(2));
+        assert(not seq.erase(2));
+        assert(not seq.contains(2));
+        assert(seq.size() == 2);
+
+        std::vector<int> seen;
+        seq.for_each([&](int e) { seen.push_back(e); });
+        assert(seen == (std::vector<int>{1, 3}));
+
+        sc::concurrent_list<std::string, std::greater<std::string>> names;
+        names.emplace(3, 'a');
+        names.insert("b");
+        std::string first;
+        names.for_each([&](const std::string &e) { if (first.empty()) first = e; });
+        assert(first == "b");
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": disjoint keys from " << n_threads << " threads.\n";
+        sc::concurrent_list<int> seq;
+        const int per_thread = 1000;
+
+        run_threads(n_threads, [&](int t) {
+            for (auto i{0}; i < per_thread; ++i)
+                assert(seq.insert(i * n_threads + t));
+            for (auto i{1}; i < per_thread; i += 2)
+                assert(seq.erase(i * n_threads + t));
+        });
+
+        assert(seq.size() == size_type(n_threads * per_thread / 2));
+        for (auto k{0}; k < n_threads * per_thread; ++k)
+            assert(seq.contains(k) == ((k / n_threads) % 2 == 0));
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": contended random operations.\n";
+        sc::concurrent_list<int> seq;
+        const int keys = 128;
+        std::vector<std::atomic<int>> balance(keys);
+
+        run_threads(n_threads, [&](int t) {
+            std::mt19937 gen(t);
+            for (auto i{0}; i < 20000; ++i)
+            {
+                int key = gen() % keys;
+                switch (gen() % 3)
+                {
+                case 0:
+                    if (seq.insert(key))
+                        balance[key]++;
+                    break;
+                case 1:
+                    if (seq.erase(key))
+                        balance[key]--;
+                    break;
+                default:
+                    seq.contains(key);
+                }
+            }
+        });
+
+        size_type expected = 0;
+        for (auto k{0}; k < keys; ++k)
+        {
+            assert(balance[k] == 0 || balance[k] == 1);
+            assert(seq.contains(k) == (balance[k] == 1));
+            expected += balance[k];
+        }
+        assert(seq.size() == expected);
+
+        int last = -1;
+        size_type count = 0;
+        seq.for_each([&](int e) {
+            assert(e > last);
+            last = e;
+            count++;
+        });
+        assert(count == expected);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": more guards than epoch slots.\n";
+        const int retired = 1000;
+
+        {
+            sc::epoch_domain domain;
+            using guard = sc::epoch_domain::guard;
+
+            // Nested guards take every slot of the table, then overflow slots.
+            std::vector<std::unique_ptr<guard>> pins;
+            for (std::size_t i = 0; i < sc::epoch_domain::max_slots + 10; i++)
+                pins.push_back(std::make_unique<guard>(domain));
+
+            // Keep only overflow slots pinned: they must still hold the epoch back.
+            pins.erase(pins.begin(), pins.begin() + sc::epoch_domain::max_slots);
+            for (int i = 0; i < retired; i++)
+            {
+                guard g(domain);
+                g.retire(new int(i), reclaimed::deleter);
+            }
+            assert(reclaimed::count == 0);
+
+            // Once they unpin, the retired nodes are freed.
+            pins.clear();
+            for (int i = 0; i < retired; i++)
+            {
+                guard g(domain);
+                g.retire(new int(i), reclaimed::deleter);
+            }
+            assert(reclaimed::count > 0);
+
+            // Threads contend for the overflow slots.
+            run_threads(n_threads, [&](int) {
+                std::vector<std::unique_ptr<guard>> mine;
+                for (std::size_t i = 0; i < sc::epoch_domain::max_slots; i++)
+                    mine.push_back(std::make_unique<guard>(domain));
+                mine.back()->retire(new int(0), reclaimed::deleter);
+            });
+        }
+        assert(reclaimed::count == 2 * retired + n_threads);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
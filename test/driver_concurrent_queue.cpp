@@ -0,0 +1,171 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/concurrent_queue.hpp"
+
+// Runs f(t) on n threads and waits for all of them.
+template <typename Function>
+void run_threads(int n, Function f)
+{
+    std::vector<std::thread> pool;
+    for (auto t{0}; t < n; ++t)
+        pool.emplace_back(f, t);
+    for (auto &th : pool)
+        th.join();
+}
+
+// The concurrent queue driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push_back(), try_pop() and FIFO order.\n";
+        sc::concurrent_queue<int> q;
+        int value = -1;
+        assert(q.empty());
+        assert(not q.try_pop(value));
+        assert(value == -1);
+
+        for (auto i{0}; i < 10; ++i)
+            q.push_back(i);
+        assert(q.size() == 10);
+
+        for (auto i{0}; i < 10; ++i)
+        {
+            assert(q.try_pop(value));
+            assert(value == i);
+        }
+        assert(q.empty());
+        assert(not q.try_pop(value));
+
+        sc::concurrent_queue<std::unique_ptr<std::string>> owners;
+        owners.emplace_back(new std::string("a"));
+        owners.push_back(std::make_unique<std::string>("b"));
+        std::unique_ptr<std::string> p;
+        assert(owners.try_pop(p) && *p == "a");
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push_bulk() and pop_bulk().\n";
+        sc::concurrent_queue<std::string> q;
+        std::vector<std::string> in{"a", "b", "c", "d", "e"};
+        q.push_bulk(in.begin(), in.end());
+        q.push_bulk(in.end(), in.end());
+        q.push_back("f");
+        assert(q.size() == 6);
+
+        std::vector<std::string> out;
+        assert(q.pop_bulk(std::back_inserter(out), 4) == 4);
+        assert(out == (std::vector<std::string>{"a", "b", "c", "d"}));
+        assert(q.pop_bulk(std::back_inserter(out), 10) == 2);
+        assert(out.back() == "f");
+        assert(q.pop_bulk(std::back_inserter(out), 10) == 0);
+        assert(q.empty());
+
+        // Elements left in the queue are destroyed with it.
+        q.push_bulk(in.begin(), in.end());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": try_pop_for() and pop_front().\n";
+        sc::concurrent_queue<int> q;
+        int value = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        assert(not q.try_pop_for(value, std::chrono::milliseconds(20)));
+        assert(std::chrono::steady_clock::now() - t0 >= std::chrono::milliseconds(20));
+
+        std::thread producer([&q] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            q.push_back(7);
+            q.push_back(8);
+        });
+        assert(q.try_pop_for(value, std::chrono::seconds(10)) && value == 7);
+        q.pop_front(value);
+        assert(value == 8);
+        producer.join();
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        const int producers = 4, consumers = 4, per_producer = 20000;
+        std::cout << ">>> Unit teste #" << ++n_unit << ": " << producers << " producers and " << consumers << " consumers.\n";
+        sc::concurrent_queue<int> q;
+        std::vector<std::atomic<int>> seen(producers * per_producer);
+        std::atomic<int> received{0};
+
+        std::thread feeders([&] {
+            run_threads(producers, [&](int t) {
+                // Alternates runs of single pushes and bulk pushes of 16 values.
+                std::vector<int> batch;
+                for (auto i{0}; i < per_producer; i += 16)
+                {
+                    batch.clear();
+                    for (auto v{i}; v < i + 16 && v < per_producer; ++v)
+                        batch.push_back(t * per_producer + v);
+
+                    if ((i / 16) % 2 == 0)
+                    {
+                        for (int v : batch)
+                            q.push_back(v);
+                    }
+                    else
+                    {
+                        q.push_bulk(batch.begin(), batch.end());
+                    }
+                }
+            });
+        });
+
+        run_threads(consumers, [&](int t) {
+            // Each producer's values must come out in increasing order.
+            std::vector<int> last(producers, -1);
+            std::vector<int> buf;
+            auto check = [&](int v) {
+                int p = v / per_producer;
+                assert(v > last[p]);
+                last[p] = v;
+                seen[v]++;
+                received++;
+            };
+
+            while (received.load() < producers * per_producer)
+            {
+                int v;
+                if (t % 2 == 0)
+                {
+                    if (q.try_pop_for(v, std::chrono::milliseconds(5)))
+                        check(v);
+                }
+                else
+                {
+                    buf.clear();
+                    q.pop_bulk(std::back_inserter(buf), 8);
+                    for (int e : buf)
+                        check(e);
+                }
+            }
+        });
+        feeders.join();
+
+        assert(q.empty());
+        for (auto &s : seen)
+            assert(s == 1);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdlib>  // rand()
+#include <deque>    // std::deque as a reference
+#include <iterator>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../include/forward_list.hpp"
+
+template <typename L, typename R>
+bool same(const L &lhs, const R &rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    auto r = rhs.begin();
+    for (auto l = lhs.begin(); l != lhs.end(); ++l, ++r)
+        if (!(*l == *r))
+            return false;
+
+    return true;
+}
+
+// The forward list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": constructors, assignment and node size.\n";
+
+        sc::forward_list<int> seq;
+        assert( seq.empty() && seq.begin() == seq.end() );
+
+        sc::forward_list<int> seq2(3);
+        assert( same(seq2, std::vector<int>{ 0, 0, 0 }) );
+
+        sc::forward_list<std::string> words{ "a", "b", "c" };
+        assert( words.front() == "a" && words.back() == "c" && words.size() == 3 );
+
+        sc::forward_list<std::string> copy(words);
+        assert( copy == words );
+
+        // Moving relinks the nodes and cannot throw.
+        static_assert( std::is_nothrow_move_constructible_v<sc::forward_list<std::string>>, "move constructor must be noexcept" );
+        static_assert( std::is_nothrow_move_assignable_v<sc::forward_list<std::string>>, "move assignment must be noexcept" );
+        sc::forward_list<std::string> moved(std::move(copy));
+        assert( copy.empty() && moved == words );
+        moved.push_back("d");
+        assert( moved.back() == "d" && moved != words );
+
+        copy = moved;
+        assert( copy == moved );
+        copy = std::move(words);
+        assert( words.empty() && copy.size() == 3 && copy.back() == "c" );
+        words = { "x" };
+        words.push_back("y");
+        assert( same(words, std::vector<std::string>{ "x", "y" }) );
+
+        // One link per node instead of two.
+        static_assert( sc::forward_list<long>::node_bytes == sizeof(void *) + sizeof(long), "a node is a link and an element" );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": queue use against std::deque.\n";
+
+        sc::forward_list<int> seq;
+        std::deque<int> model;
+
+        for (int step = 0; step < 20000; step++)
+        {
+            int op = std::rand() % 5;
+            if (op < 2)
+            {
+                seq.push_back(step);
+                model.push_back(step);
+            }
+            else if (op == 2)
+            {
+                seq.push_front(step);
+                model.push_front(step);
+            }
+            else if (!model.empty())
+            {
+                assert( seq.front() == model.front() );
+                seq.pop_front();
+                model.pop_front();
+            }
+
+            if (!model.empty())
+                assert( seq.back() == model.back() );
+        }
+        assert( same(seq, model) );
+
+        // Emptying the list leaves the tail on the head, so push_back works again.
+        while (!seq.empty())
+            seq.pop_front();
+        seq.push_back(1);
+        seq.push_front(0);
+        assert( same(seq, std::vector<int>{ 0, 1 }) && seq.back() == 1 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": insert_after() and erase_after().\n";
+
+        sc::forward_list<int> seq{ 1, 2, 3 };
+        auto it = seq.insert_after(seq.begin(), 10);
+        assert( *it == 10 && same(seq, std::vector<int>{ 1, 10, 2, 3 }) );
+
+        it = seq.insert_after(seq.before_end(), { 4, 5 });
+        assert( *it == 5 && seq.back() == 5 );
+
+        it = seq.erase_after(seq.begin());
+        assert( *it == 2 && same(seq, std::vector<int>{ 1, 2, 3, 4, 5 }) );
+
+        // Erasing the last element moves the tail back.
+        seq.erase_after(seq.begin() + 3);
+        assert( seq.back() == 4 );
+        seq.push_back(6);
+        assert( same(seq, std::vector<int>{ 1, 2, 3, 4, 6 }) );
+
+        it = seq.erase_after(seq.begin(), seq.end());
+        assert( it == seq.end() && seq.size() == 1 && seq.back() == 1 );
+        seq.push_back(2);
+        seq.erase_after(seq.before_begin(), seq.end());
+        assert( seq.empty() );
+        seq.push_back(3);
+        assert( seq.front() == 3 && seq.back() == 3 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": splice_after().\n";
+
+        sc::forward_list<int> seq{ 1, 2, 3 };
+        sc::forward_list<int> batch{ 7, 8, 9 };
+
+        // A whole list, at the back, in O(1).
+        seq.splice_after(seq.before_end(), batch);
+        assert( batch.empty() && same(seq, std::vector<int>{ 1, 2, 3, 7, 8, 9 }) && seq.back() == 9 );
+        batch.push_back(0);
+        assert( batch.front() == 0 && batch.back() == 0 );
+
+        // One element, from the back of another list.
+        sc::forward_list<int> other{ 4, 5 };
+        seq.splice_after(seq.begin() + 2, other, other.begin());
+        assert( same(seq, std::vector<int>{ 1, 2, 3, 5, 7, 8, 9 }) );
+        assert( other.size() == 1 && other.back() == 4 );
+        other.push_back(6);
+        assert( same(other, std::vector<int>{ 4, 6 }) );
+
+        // A range that ends at the tail of its list, to the back of another.
+        other.splice_after(other.before_end(), seq, seq.begin() + 3, seq.end());
+        assert( same(seq, std::vector<int>{ 1, 2, 3, 5 }) && seq.back() == 5 );
+        assert( same(other, std::vector<int>{ 4, 6, 7, 8, 9 }) && other.back() == 9 );
+
+        // Within the same list: the tail follows the moved range.
+        seq.splice_after(seq.before_end(), seq, seq.before_begin(), seq.begin() + 2);
+        assert( same(seq, std::vector<int>{ 3, 5, 1, 2 }) && seq.back() == 2 );
+        seq.splice_after(seq.before_begin(), seq, seq.begin() + 2);
+        assert( same(seq, std::vector<int>{ 2, 3, 5, 1 }) && seq.back() == 1 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": stats policy.\n";
+
+        using tracked = sc::forward_list<int, std::allocator<int>, sc::list_stats>;
+        tracked seq{ 1, 2, 3 };
+        seq.push_back(4);
+        seq.pop_front();
+        assert( seq.stats().allocations == 4 && seq.stats().frees == 1 );
+        assert( seq.stats().peak_size == 4 );
+
+        auto it = seq.begin() + 2;
+        assert( *it == 4 );
+        assert( seq.stats().hops(sc::list_op::advance).hops == 2 );
+
+        tracked other{ 5, 6, 7 };
+        seq.splice_after(seq.before_begin(), other, other.before_begin(), other.end());
+        assert( seq.stats().hops(sc::list_op::splice).hops == 3 && seq.stats().peak_size == 6 );
+
+        seq.clear();
+        assert( seq.stats().frees == 7 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdlib>  // rand()
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <type_traits>
+#include "../include/indexed_list.hpp"
+
+// An element looked up by its id.
+struct account
+{
+    int id;
+    std::string owner;
+
+    bool operator==(const account &rhs) const { return id == rhs.id && owner == rhs.owner; }
+};
+
+struct account_id
+{
+    int operator()(const account &a) const { return a.id; }
+};
+
+// A hasher whose result depends on its seed.
+struct seeded_hash
+{
+    std::size_t seed;
+
+    std::size_t operator()(int key) const { return std::hash<int>()(key) * 31 + seed; }
+};
+
+// An allocator with an identity that compares equal to any other and does not propagate on move.
+template <typename T>
+struct tagged_alloc : std::allocator<T>
+{
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = tagged_alloc<U>;
+    };
+
+    int tag;
+
+    tagged_alloc(int t = 0) : tag{t} {}
+
+    template <typename U>
+    tagged_alloc(const tagged_alloc<U> &other) : tag{other.tag} {}
+
+    bool operator==(const tagged_alloc &) const { return true; }
+    bool operator!=(const tagged_alloc &) const { return false; }
+};
+
+// Returns the elements of a list, in order.
+template <typename List>
+std::vector<typename List::key_type> keys(const List &seq)
+{
+    std::vector<typename List::key_type> out;
+    for (auto it = seq.begin(); it != seq.end(); ++it)
+        out.push_back(*it);
+    return out;
+}
+
+// The indexed list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": insertion order and unique elements.\n";
+
+        sc::indexed_list<int> seq{ 5, 3, 5, 1 };
+        assert( seq.size() == 3 );
+        assert( keys(seq) == ( std::vector<int>{ 5, 3, 1 } ) );
+
+        auto r = seq.push_back(3);
+        assert( !r.second && *r.first == 3 && seq.size() == 3 );
+        r = seq.push_front(7);
+        assert( r.second && r.first == seq.begin() );
+        r = seq.insert(seq.begin() + 2, 9);
+        assert( r.second && keys(seq) == ( std::vector<int>{ 7, 5, 9, 3, 1 } ) );
+        assert( seq.front() == 7 && seq.back() == 1 && seq.end() - seq.begin() == 5 );
+
+        seq.pop_front();
+        seq.pop_back();
+        assert( keys(seq) == ( std::vector<int>{ 5, 9, 3 } ) );
+        assert( !seq.contains(7) && !seq.contains(1) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": find(), contains(), erase(key) and move_to_front().\n";
+
+        sc::indexed_list<std::string> seq{ "a", "b", "c", "d" };
+        assert( *seq.find("c") == "c" );
+        assert( seq.find("z") == seq.end() );
+        assert( seq.contains("a") && !seq.contains("z") );
+
+        assert( seq.erase("b") == 1 );
+        assert( seq.erase("b") == 0 );
+        assert( keys(seq) == ( std::vector<std::string>{ "a", "c", "d" } ) );
+
+        assert( seq.move_to_front("d") );
+        assert( !seq.move_to_front("z") );
+        assert( seq.move_to_front("d") );
+        assert( keys(seq) == ( std::vector<std::string>{ "d", "a", "c" } ) );
+
+        seq.move_to_back(seq.begin());
+        assert( keys(seq) == ( std::vector<std::string>{ "a", "c", "d" } ) );
+
+        auto it = seq.erase(seq.find("a"));
+        assert( *it == "c" );
+        seq.erase(seq.begin(), seq.end());
+        assert( seq.empty() && !seq.contains("c") );
+
+        seq.push_back("again");
+        assert( seq.contains("again") );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": extracted keys.\n";
+
+        sc::indexed_list<account, std::hash<int>, account_id> accounts;
+        accounts.push_back({ 10, "ana" });
+        accounts.push_back({ 20, "bia" });
+        assert( !accounts.push_back({ 10, "caio" }).second );
+
+        assert( accounts.find(20)->owner == "bia" );
+        assert( accounts.contains(10) && !accounts.contains(30) );
+        accounts.move_to_front(20);
+        assert( accounts.front().id == 20 );
+        assert( accounts.erase(10) == 1 && accounts.size() == 1 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": copy, move and growth of the index against a model.\n";
+
+        sc::indexed_list<int> seq;
+        std::list<int> model;
+        std::unordered_map<int, std::list<int>::iterator> where;
+
+        // Keys that are multiples of a large power of two would all collide on a plain mask.
+        for (int step = 0; step < 20000; step++)
+        {
+            int key = (std::rand() % 4000) * 1024;
+            int op = std::rand() % 4;
+
+            if (op < 2)
+            {
+                bool inserted = seq.push_back(key).second;
+                assert( inserted == (where.count(key) == 0) );
+                if (inserted)
+                    where[key] = model.insert(model.end(), key);
+            }
+            else if (op == 2)
+            {
+                assert( seq.erase(key) == where.count(key) );
+                if (where.count(key))
+                {
+                    model.erase(where[key]);
+                    where.erase(key);
+                }
+            }
+            else
+            {
+                assert( seq.move_to_front(key) == (where.count(key) == 1) );
+                if (where.count(key))
+                    model.splice(model.begin(), model, where[key]);
+            }
+        }
+
+        assert( keys(seq) == std::vector<int>(model.begin(), model.end()) );
+        assert( seq.bucket_count() >= seq.size() );
+
+        sc::indexed_list<int> copy(seq);
+        assert( copy == seq );
+        for (int key : model)
+            assert( *copy.find(key) == key );
+
+        // Moving takes over the nodes and the buckets; std::hash and std::equal_to copy without throwing.
+        static_assert( std::is_nothrow_move_constructible_v<sc::indexed_list<int>>, "move constructor must be noexcept" );
+        static_assert( std::is_nothrow_move_assignable_v<sc::indexed_list<int>>, "move assignment must be noexcept" );
+        sc::indexed_list<int> moved(std::move(copy));
+        assert( copy.empty() && !copy.contains(model.front()) && moved == seq );
+        copy.push_back(1);
+        assert( copy.contains(1) );
+
+        copy = moved;
+        assert( copy == seq );
+        moved = sc::indexed_list<int>{ 1, 2 };
+        assert( moved.contains(2) && !moved.contains(model.front()) );
+
+        seq.clear();
+        assert( seq.empty() && seq.find(model.front()) == seq.end() );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": move assignment with stateful hashers and allocators.\n";
+        using seeded = sc::indexed_list<int, seeded_hash, sc::identity_key, std::equal_to<>, tagged_alloc<int>>;
+
+        seeded a(tagged_alloc<int>(1), seeded_hash{7}), b(tagged_alloc<int>(2), seeded_hash{1000003});
+        for (auto i{0}; i < 100; ++i)
+            a.push_back(i);
+        b.push_back(-1);
+
+        // The nodes carry hashes from the seed of a, so its hasher must come along.
+        b = std::move(a);
+        assert(a.empty() && b.size() == 100);
+        for (auto i{0}; i < 100; ++i)
+            assert(b.contains(i) && *b.find(i) == i);
+        assert(not b.contains(-1));
+
+        // Equal allocators that do not propagate stay put.
+        assert(b.get_allocator().tag == 2);
+
+        seeded c(tagged_alloc<int>(3), seeded_hash{42});
+        c = b;
+        for (auto i{0}; i < 100; ++i)
+            assert(c.contains(i));
+        c.push_back(100);
+        assert(c.size() == 101 && c.contains(100));
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../include/intrusive_list.hpp"
+
+// An object that can be in two lists at the same time.
+struct Task
+{
+    int id;
+    std::string name;
+    sc::list_hook all;   // Every task
+    sc::list_hook ready; // Tasks ready to run
+
+    Task(int i, std::string n) : id{i}, name{std::move(n)} {}
+
+    bool operator==(const Task &rhs) const { return id == rhs.id; }
+};
+
+// Not standard layout: a virtual base and members with different access.
+struct Shape
+{
+    virtual ~Shape() = default;
+    virtual int area() const = 0;
+};
+
+struct Square : Shape
+{
+    Square(int s) : side{s} {}
+    int area() const override { return side * side; }
+
+    sc::list_hook hook;
+
+private:
+    int side;
+};
+
+using all_list = sc::intrusive_list<Task, &Task::all>;
+using ready_list = sc::intrusive_list<Task, &Task::ready>;
+
+// Returns the ids of the tasks of a list, in order.
+template <typename List>
+std::vector<int> ids(const List &seq)
+{
+    std::vector<int> out;
+    for (const auto &t : seq)
+        out.push_back(t.id);
+    return out;
+}
+
+// The intrusive list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push, pop and iteration.\n";
+        std::vector<Task> arena;
+        for (auto i{0}; i < 5; ++i)
+            arena.emplace_back(i, "task" + std::to_string(i));
+
+        all_list seq;
+        assert(seq.empty() && seq.begin() == seq.end());
+        for (auto i{1}; i < 4; ++i)
+            seq.push_back(arena[i]);
+        seq.push_front(arena[0]);
+        assert(seq.size() == 4);
+        assert(ids(seq) == (std::vector<int>{0, 1, 2, 3}));
+        assert(not arena[4].all.is_linked());
+
+        seq.push_back(arena[4]);
+        assert(seq.front().id == 0 && seq.back().name == "task4");
+        assert((seq.begin() + 2)->id == 2);
+        assert(seq.end() - seq.begin() == 5);
+
+        auto it = seq.end();
+        assert((--it)->id == 4);
+
+        seq.pop_front();
+        seq.pop_back();
+        assert(ids(seq) == (std::vector<int>{1, 2, 3}));
+        assert(not arena[0].all.is_linked() && arena[1].all.is_linked());
+
+        // The objects are untouched by the list.
+        assert(&*seq.begin() == &arena[1]);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": O(1) erase of a held object and two lists at once.\n";
+        std::vector<Task> arena;
+        for (auto i{0}; i < 6; ++i)
+            arena.emplace_back(i, "");
+
+        all_list all;
+        ready_list ready;
+        for (auto &t : arena)
+        {
+            all.push_back(t);
+            if (t.id % 2 == 0)
+                ready.push_front(t);
+        }
+        assert(ids(ready) == (std::vector<int>{4, 2, 0}));
+
+        ready.erase(arena[2]);
+        all.erase(arena[3]);
+        assert(ids(ready) == (std::vector<int>{4, 0}));
+        assert(ids(all) == (std::vector<int>{0, 1, 2, 4, 5}));
+        assert(arena[2].all.is_linked() && not arena[2].ready.is_linked());
+
+        auto pos = all.insert(all_list::iterator_to(arena[4]), arena[3]);
+        assert(&*pos == &arena[3]);
+        assert(ids(all) == (std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+        auto after = all.erase(all_list::iterator_to(arena[1]), all_list::iterator_to(arena[4]));
+        assert(&*after == &arena[4]);
+        assert(ids(all) == (std::vector<int>{0, 4, 5}));
+
+        // A copy of a linked object is not linked.
+        Task copy(arena[0]);
+        assert(not copy.all.is_linked());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": move, splice and clear.\n";
+        std::vector<Task> arena;
+        for (auto i{0}; i < 6; ++i)
+            arena.emplace_back(i, "");
+
+        all_list a, b;
+        for (auto i{0}; i < 3; ++i)
+            a.push_back(arena[i]);
+        for (auto i{3}; i < 6; ++i)
+            b.push_back(arena[i]);
+
+        a.splice(a.begin() + 1, b);
+        assert(b.empty());
+        assert(ids(a) == (std::vector<int>{0, 3, 4, 5, 1, 2}));
+
+        // Moving only relinks hooks.
+        static_assert(std::is_nothrow_move_constructible_v<all_list>, "move constructor must be noexcept");
+        static_assert(std::is_nothrow_move_assignable_v<all_list>, "move assignment must be noexcept");
+        all_list c(std::move(a));
+        assert(a.empty() && c.size() == 6);
+        assert(ids(c) == (std::vector<int>{0, 3, 4, 5, 1, 2}));
+
+        Task extra(9, "");
+        b.push_back(extra);
+        b = std::move(c);
+        assert(c.empty() && b.size() == 6);
+        assert(not extra.all.is_linked());
+
+        b.clear();
+        for (auto &t : arena)
+            assert(not t.all.is_linked());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": objects that are not standard layout.\n";
+        static_assert(!std::is_standard_layout_v<Square>, "the hook offset must not rely on standard layout");
+
+        std::vector<Square> squares{1, 2, 3};
+        sc::intrusive_list<Square, &Square::hook> seq;
+        for (auto &sq : squares)
+            seq.push_front(sq);
+
+        std::vector<int> areas;
+        for (const Shape &sh : seq)
+            areas.push_back(sh.area());
+        assert(areas == (std::vector<int>{9, 4, 1}));
+        assert(&*seq.begin() == &squares[2] && &seq.back() == &squares[0]);
+
+        seq.clear();
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -1,6 +1,62 @@
 #include <iostream> // cout, endl
 #include <cassert>  // assert()
+#include <algorithm> // stable_sort()
+#include <cstdlib>   // rand()
+#include <memory>   // unique_ptr
+#include <utility>  // pair
+#include <vector>
+#include <memory_resource>
+#include <iterator> // istream_iterator
+#include <sstream>
+#include <type_traits> // is_empty
+#include <stdexcept>
+#include <string>
 #include "../include/list.hpp"
+#include "../include/slab_allocator.hpp"
+
+/// Counts the calls and the bytes in use of every counting_allocator.
+struct alloc_counter
+{
+    static inline long calls = 0;
+    static inline long bytes = 0;
+};
+
+/// Allocator that records its activity in alloc_counter.
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(std::size_t n)
+    {
+        alloc_counter::calls++;
+        alloc_counter::bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        alloc_counter::bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const counting_allocator<U> &) const { return true; }
+    template <typename U>
+    bool operator!=(const counting_allocator<U> &) const { return false; }
+};
+
+/// Element whose copy constructor, also used to move it, throws when v is 3.
+struct Fragile
+{
+    int v;
+    Fragile(int x) : v{x} {}
+    Fragile(const Fragile &o) : v{o.v} { if (v == 3) throw std::runtime_error("copy"); }
+};
 
 template <typename T = int>
 sc::list<T> createVec(const sc::list<T> &_v)
@@ -134,8 +190,6 @@ int main(void)
     }
     
     // Unit: Move assign operator.
-#ifdef MOVE_SYNTAX_IMPLEMENTED
-    //
     {
         std::cout << ">>> Unit teste #" << ++n_unit << ": move assign operator.\n";
         sc::list<int> seq{1, 2, 3, 4, 5};
@@ -154,7 +208,6 @@ int main(void)
 
         std::cout << ">>> Passed!\n\n";
     }
-#endif
 
     {
         std::cout << ">>> Unit teste #" << ++n_unit << ": initializer list assignment.\n";
@@ -512,5 +565,747 @@ int main(void)
 
         std::cout << ">>> Passed!\n\n";
     }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": insert/erase at a held iterator.\n";
+
+        sc::list<int> seq{ 1, 2, 3, 4, 5 };
+        auto pos = seq.begin() + 2;
+
+        // pos keeps pointing to 3 while elements are inserted before it.
+        auto first = seq.insert( pos, { 7, 8 } );
+        assert( *first == 7 );
+        assert( *pos == 3 );
+        first = seq.insert( pos, seq.begin(), seq.begin() + 2 );
+        assert( *first == 1 );
+        assert( seq == ( sc::list<int>{ 1, 2, 7, 8, 1, 2, 3, 4, 5 } ) );
+        assert( seq.size() == 9 );
+
+        // Empty ranges leave the list untouched and return pos.
+        assert( seq.insert( pos, {} ) == pos );
+        assert( seq.erase( pos, pos ) == pos );
+
+        pos = seq.erase( first, pos );
+        assert( *pos == 3 );
+        assert( seq == ( sc::list<int>{ 1, 2, 7, 8, 3, 4, 5 } ) );
+        assert( seq.size() == 7 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": emplace and move-only payloads.\n";
+
+        sc::list<std::unique_ptr<int>> seq;
+        seq.emplace_back(new int(2));
+        seq.emplace_front(new int(1));
+        seq.push_back(std::unique_ptr<int>(new int(4)));
+        auto it = seq.emplace(seq.begin() + 2, new int(3));
+        assert( **it == 3 );
+        assert( seq.size() == 4 );
+
+        auto i{0};
+        for (const auto &e : seq)
+            assert( *e == ++i );
+
+        // Moving the list hands over the nodes, the source is left empty.
+        sc::list<std::unique_ptr<int>> seq2(std::move(seq));
+        assert( seq2.size() == 4 );
+        assert( seq.empty() );
+        seq = std::move(seq2);
+        assert( seq.size() == 4 );
+        assert( seq2.empty() );
+        assert( *seq.back() == 4 );
+
+        // Moves do not throw, so containers of lists move them instead of copying them.
+        static_assert( std::is_nothrow_move_constructible_v<sc::list<int>>, "move constructor must be noexcept" );
+        static_assert( std::is_nothrow_move_assignable_v<sc::list<int>>, "move assignment must be noexcept" );
+        static_assert( !std::is_nothrow_move_assignable_v<sc::list<int, std::pmr::polymorphic_allocator<int>>>,
+                       "move assignment may copy with allocators that differ" );
+
+        std::vector<sc::list<int>> lists(1, sc::list<int>{ 1, 2, 3 });
+        const int *first = &lists[0].front();
+        for (int k = 0; k < 100; k++)
+            lists.emplace_back();
+        assert( &lists[0].front() == first );
+
+        // emplace_back builds the string from its constructor arguments.
+        sc::list<std::string> names;
+        assert( names.emplace_back(3, 'a') == "aaa" );
+        std::string name("bbb");
+        names.push_back(std::move(name));
+        assert( names.back() == "bbb" );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": empty lists and non-default-constructible T.\n";
+
+        // The null resource throws on any allocation, so empty lists must not allocate at all.
+        std::pmr::polymorphic_allocator<int> null_alloc(std::pmr::null_memory_resource());
+        sc::list<int, std::pmr::polymorphic_allocator<int>> seq(null_alloc);
+        auto seq2(seq);
+        auto seq3(std::move(seq2));
+        seq3 = seq;
+        seq3.clear();
+        assert( seq3.empty() );
+        assert( seq3.begin() == seq3.end() );
+
+        struct NoDefault
+        {
+            int value;
+            explicit NoDefault(int v) : value{v} {}
+        };
+
+        sc::list<NoDefault> items;
+        items.emplace_back(2);
+        items.emplace_front(1);
+        items.emplace(items.end(), 3);
+
+        auto i{0};
+        for (const auto &e : items)
+            assert( e.value == ++i );
+        assert( i == 3 );
+
+        // Moving a list re-links its nodes to the new sentinel.
+        sc::list<NoDefault> moved(std::move(items));
+        assert( items.empty() );
+        assert( moved.size() == 3 );
+        moved.pop_back();
+        assert( moved.back().value == 2 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": sort().\n";
+
+        sc::list<int> seq{ 5, 3, 9, 1, 1, 7 };
+        auto first = seq.begin();
+        const int *addr = &*first;
+        seq.sort();
+        assert( seq == ( sc::list<int>{ 1, 1, 3, 5, 7, 9 } ) );
+        // The node is relinked, not copied.
+        assert( &*( seq.begin() + 3 ) == addr );
+
+        seq.sort(std::greater<int>());
+        assert( seq == ( sc::list<int>{ 9, 7, 5, 3, 1, 1 } ) );
+        assert( seq.back() == 1 );
+
+        // Stability against std::stable_sort on a large random input.
+        using item = std::pair<int, int>;
+        std::vector<item> ref;
+        sc::list<item> big;
+        std::srand(7);
+        for (auto i{0}; i < 10000; ++i)
+        {
+            ref.emplace_back(std::rand() % 100, i);
+            big.push_back(ref.back());
+        }
+
+        auto by_key = [](const item &a, const item &b) { return a.first < b.first; };
+        std::stable_sort(ref.begin(), ref.end(), by_key);
+        big.sort(by_key);
+
+        auto i{0};
+        for (const auto &e : big)
+            assert( e == ref[i++] );
+
+        // prev links must be rebuilt.
+        auto it = big.end();
+        for (auto j = ref.size(); j > 0; --j)
+            assert( *(--it) == ref[j - 1] );
+
+        // A comparator that throws, at any point of the sort, leaves every element in a valid list.
+        std::vector<int> values;
+        for (auto k{0}; k < 1000; ++k)
+            values.push_back(std::rand() % 50);
+        for (int throw_at : { 1, 2, 10, 100, 999, 1500, 5000 })
+        {
+            sc::list<int> victim(values.begin(), values.end());
+            int calls = 0;
+            try
+            {
+                victim.sort([&calls, throw_at](int a, int b) {
+                    if (++calls == throw_at)
+                        throw std::runtime_error("compare");
+                    return a < b;
+                });
+            }
+            catch (const std::runtime_error &)
+            {
+            }
+
+            std::vector<int> forward(victim.begin(), victim.end());
+            std::vector<int> backward;
+            for (auto b = victim.end(); b != victim.begin();)
+                backward.push_back(*(--b));
+            std::reverse(backward.begin(), backward.end());
+            assert( victim.size() == values.size() && forward == backward );
+
+            std::vector<int> expected(values);
+            std::sort(forward.begin(), forward.end());
+            std::sort(expected.begin(), expected.end());
+            assert( forward == expected );
+        }
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": merge() and splice().\n";
+
+        sc::list<int> seq1{ 1, 3, 5, 7 };
+        sc::list<int> seq2{ 0, 2, 3, 8, 9 };
+        seq1.merge(seq2);
+        assert( seq1 == ( sc::list<int>{ 0, 1, 2, 3, 3, 5, 7, 8, 9 } ) );
+        assert( seq1.size() == 9 );
+        assert( seq2.empty() );
+
+        // Whole list.
+        seq2 = { 10, 20 };
+        seq1.splice( seq1.begin() + 1, seq2 );
+        assert( seq1 == ( sc::list<int>{ 0, 10, 20, 1, 2, 3, 3, 5, 7, 8, 9 } ) );
+        assert( seq1.size() == 11 );
+        assert( seq2.empty() );
+
+        // Single element.
+        seq2.splice( seq2.end(), seq1, seq1.begin() + 1 );
+        assert( seq2 == ( sc::list<int>{ 10 } ) );
+        assert( seq1.size() == 10 );
+
+        // Range between lists.
+        seq2.splice( seq2.begin(), seq1, seq1.begin(), seq1.begin() + 3 );
+        assert( seq2 == ( sc::list<int>{ 0, 20, 1, 10 } ) );
+        seq1.splice( seq1.end(), seq2, seq2.begin(), seq2.begin() + 2 );
+        assert( seq1 == ( sc::list<int>{ 2, 3, 3, 5, 7, 8, 9, 0, 20 } ) );
+        assert( seq2.size() == 2 );
+
+        // Range inside the same list.
+        seq1.splice( seq1.begin(), seq1, seq1.begin() + 7, seq1.end() );
+        assert( seq1 == ( sc::list<int>{ 0, 20, 2, 3, 3, 5, 7, 8, 9 } ) );
+        assert( seq1.size() == 9 );
+        seq1.splice( seq1.begin(), seq1, seq1.begin() );
+        assert( seq1.front() == 0 );
+
+        // A comparator that throws leaves both lists whole, with the right sizes.
+        sc::list<int> lhs{ 1, 3, 5, 7 };
+        sc::list<int> rhs{ 2, 4, 6, 8 };
+        int calls = 0;
+        try
+        {
+            lhs.merge(rhs, [&calls](int a, int b) {
+                if (++calls == 4)
+                    throw std::runtime_error("compare");
+                return a < b;
+            });
+            assert( false );
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        assert( lhs.size() + rhs.size() == 8 );
+        assert( std::distance(lhs.begin(), lhs.end()) == long(lhs.size()) );
+        assert( std::distance(rhs.begin(), rhs.end()) == long(rhs.size()) );
+        assert( lhs.size() > 4 && rhs.size() < 4 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": unique(), remove_if() and reverse().\n";
+
+        sc::list<int> seq{ 1, 1, 2, 2, 2, 3, 1, 1 };
+        assert( seq.unique() == 4 );
+        assert( seq == ( sc::list<int>{ 1, 2, 3, 1 } ) );
+
+        assert( seq.remove(1) == 2 );
+        assert( seq == ( sc::list<int>{ 2, 3 } ) );
+
+        seq = { 1, 2, 3, 4, 5, 6 };
+        assert( seq.remove_if([](int e) { return e % 2 == 0; }) == 3 );
+        assert( seq == ( sc::list<int>{ 1, 3, 5 } ) );
+        assert( seq.size() == 3 );
+
+        seq.reverse();
+        assert( seq == ( sc::list<int>{ 5, 3, 1 } ) );
+        assert( seq.back() == 1 );
+        assert( *(--seq.end()) == 1 );
+
+        sc::list<int> empty;
+        empty.reverse();
+        empty.sort();
+        assert( empty.unique() == 0 );
+        assert( empty.empty() );
+
+        // value may be an element of the list, as with std::list. Long strings, so they own heap memory.
+        const std::string ab(32, 'a'), cd(32, 'c'), ef(32, 'e');
+        sc::list<std::string> words{ ab, cd, ab, ef, ab };
+        assert( words.remove(words.front()) == 3 );
+        assert( words == ( sc::list<std::string>{ cd, ef } ) );
+        words = { ab, cd, ab };
+        assert( words.remove(words.back()) == 2 && words.size() == 1 && words.front() == cd );
+
+        // A predicate holding on to an element that unique() removes.
+        words = { "x", "y", "y", "z" };
+        const std::string *seen = nullptr;
+        assert( words.unique([&seen](const std::string &a, const std::string &b) {
+            bool dup = (seen != nullptr && *seen == b) || a == b;
+            seen = &b;
+            return dup;
+        }) == 1 );
+        assert( words == ( sc::list<std::string>{ "x", "y", "z" } ) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": find().\n";
+
+        sc::list<int> seq{ 4, 8, 15, 16, 23, 42, 15 };
+        auto it = seq.find(15);
+        assert( it == seq.begin() + 2 );
+        *it = 14;
+        assert( seq.find(15) == seq.begin() + 6 );
+        assert( seq.find(99) == seq.end() );
+
+        const sc::list<int> &view = seq;
+        assert( *view.find(42) == 42 );
+        assert( view.find(99) == view.cend() );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": find_if(), count(), assign() and comparisons against std algorithms.\n";
+
+        // Both walks of the kernels meet in the middle, so lists of odd and even length are checked.
+        for (int length = 0; length < 24; length++)
+        {
+            std::vector<int> model;
+            for (int i = 0; i < length; i++)
+                model.push_back(std::rand() % 4);
+            sc::list<int> seq(model.begin(), model.end());
+
+            for (int v = 0; v < 5; v++)
+            {
+                auto expected = std::find(model.begin(), model.end(), v) - model.begin();
+                assert( std::distance(seq.begin(), seq.find(v)) == expected );
+                assert( seq.count(v) == size_type(std::count(model.begin(), model.end(), v)) );
+
+                const sc::list<int> &view = seq;
+                auto greater = view.find_if([v](int e) { return e > v; });
+                assert( std::distance(view.cbegin(), greater) == std::find_if(model.begin(), model.end(), [v](int e) { return e > v; }) - model.begin() );
+
+                // find_if() calls pred front to back and stops at the first match, like std::find_if.
+                std::vector<int> seen;
+                auto match = seq.find_if([&seen, v](int e) { seen.push_back(e); return e == v; });
+                std::vector<int> prefix(model.begin(), model.begin() + std::min<long>(expected + 1, length));
+                assert( seen == prefix && std::distance(seq.begin(), match) == expected );
+            }
+
+            // Lists that differ in one element, at any position, or in their length.
+            for (int at = 0; at <= length; at++)
+            {
+                std::vector<int> other(model);
+                if (at < length)
+                    other[at] += (at % 2 == 0) ? 1 : -1;
+                else
+                    other.push_back(0);
+
+                sc::list<int> seq2(other.begin(), other.end());
+                assert( (seq == seq2) == (model == other) );
+                assert( (seq != seq2) == (model != other) );
+                assert( (seq < seq2) == (model < other) );
+                assert( (seq2 < seq) == (other < model) );
+                assert( (seq <= seq2) == (model <= other) && (seq >= seq2) == (model >= other) );
+            }
+            assert( seq == sc::list<int>(model.begin(), model.end()) && !(seq < seq) );
+
+            seq.assign(7);
+            assert( seq.count(7) == size_type(length) && seq.size() == size_type(length) );
+        }
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": slab_allocator.\n";
+
+        // Two lists sharing the same slab resource.
+        sc::slab_allocator<int> alloc;
+        sc::list<int, sc::slab_allocator<int>> seq1(alloc);
+        sc::list<int, sc::slab_allocator<int>> seq2({ 1, 2, 3 }, alloc);
+        assert( seq1.get_allocator() == seq2.get_allocator() );
+
+        for (auto i{0}; i < 1000; ++i)
+            seq1.push_back(i);
+        while (seq1.size() > 1)
+            seq1.pop_back();
+        for (auto i{0}; i < 1000; ++i)
+            seq1.push_front(i);
+
+        assert( seq1.size() == 1001 );
+        assert( seq1.front() == 999 );
+        assert( seq1.back() == 0 );
+        assert( seq2 == ( sc::list<int, sc::slab_allocator<int>>{ { 1, 2, 3 }, alloc } ) );
+
+        // A copy shares the resource too.
+        auto seq3(seq2);
+        assert( seq3.get_allocator() == alloc );
+        assert( seq3 == seq2 );
+
+        // Lists on top of a polymorphic memory resource.
+        sc::slab_resource resource;
+        std::pmr::polymorphic_allocator<int> pmr_alloc(&resource);
+        sc::list<int, std::pmr::polymorphic_allocator<int>> seq4({ 1, 2, 3, 4, 5 }, pmr_alloc);
+        seq4.erase( seq4.begin() + 1, seq4.begin() + 3 );
+        seq4.insert( seq4.begin() + 1, 9 );
+        assert( seq4.size() == 4 );
+        assert( seq4.get_allocator().resource() == &resource );
+
+        auto i{0};
+        int expected[] = { 1, 9, 4, 5 };
+        for (const auto &e : seq4)
+            assert( e == expected[i++] );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": append_range(), prepend_range() and insert_range().\n";
+
+        sc::list<int> seq{ 4, 5 };
+        std::vector<int> front{ 1, 2, 3 };
+        int back[] = { 8, 9 };
+
+        seq.prepend_range(front);
+        seq.append_range(back);
+        assert( seq == ( sc::list<int>{ 1, 2, 3, 4, 5, 8, 9 } ) );
+        assert( seq.size() == 7 );
+
+        auto it = seq.insert_range(seq.begin() + 5, sc::list<int>{ 6, 7 });
+        assert( *it == 6 );
+        assert( seq == ( sc::list<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9 } ) );
+        assert( *(--seq.end()) == 9 && *(--(--seq.end())) == 8 );
+
+        it = seq.insert_range(seq.begin(), std::vector<int>{});
+        assert( it == seq.begin() && seq.size() == 9 );
+
+        // Input ranges are read in one pass.
+        std::istringstream in("10 11 12");
+        it = seq.insert(seq.end(), std::istream_iterator<int>(in), std::istream_iterator<int>());
+        assert( *it == 10 && seq.back() == 12 && seq.size() == 12 );
+
+        // A throwing element leaves the list as it was.
+        sc::list<Fragile> fragile;
+        fragile.emplace_back(0);
+        std::vector<Fragile> source{ Fragile(1), Fragile(2) };
+        source.emplace_back(3);
+        bool thrown = false;
+        try
+        {
+            fragile.append_range(source);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert( thrown && fragile.size() == 1 && fragile.back().v == 0 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": single-allocation construction.\n";
+        using counted = sc::list<int, counting_allocator<int>>;
+
+        {
+            alloc_counter::calls = 0;
+            counted seq(1000);
+            assert( alloc_counter::calls == 1 );
+
+            // The nodes are laid out in address order.
+            const int *prev = nullptr;
+            std::ptrdiff_t stride = 0;
+            for (const auto &e : seq)
+            {
+                if (prev != nullptr)
+                {
+                    if (stride == 0)
+                        stride = reinterpret_cast<const char *>(&e) - reinterpret_cast<const char *>(prev);
+                    assert( stride > 0 );
+                    assert( reinterpret_cast<const char *>(&e) - reinterpret_cast<const char *>(prev) == stride );
+                }
+                prev = &e;
+            }
+
+            alloc_counter::calls = 0;
+            counted copy(seq);
+            counted init{ 1, 2, 3, 4, 5 };
+            std::vector<int> source{ 1, 2, 3 };
+            counted range(source.begin(), source.end());
+            assert( alloc_counter::calls == 3 );
+
+            // A single-pass range still gets a node per element.
+            std::istringstream in("1 2 3");
+            counted streamed{ std::istream_iterator<int>(in), std::istream_iterator<int>() };
+            assert( alloc_counter::calls == 6 );
+            assert( streamed == range );
+
+            // Nodes of a block can be erased, and the list grows with ordinary nodes.
+            init.erase( init.begin() + 1 );
+            init.pop_front();
+            init.push_front(0);
+            init.insert( init.begin() + 2, 9 );
+            assert( init == ( counted{ 0, 3, 9, 4, 5 } ) );
+
+            // Nodes spliced or merged into other lists outlive the list that built them.
+            // Relinking block nodes never calls the allocator.
+            counted other{ 100 };
+            {
+                counted donor{ 10, 20, 30, 40 };
+                counted sorted{ 1, 50 };
+                alloc_counter::calls = 0;
+                other.splice( other.end(), donor, donor.begin() + 1, donor.begin() + 3 );
+                other.merge(sorted);
+                assert( alloc_counter::calls == 0 );
+            }
+            assert( other == ( counted{ 1, 50, 100, 20, 30 } ) );
+            other.erase( other.begin() + 3 );
+
+            counted moved(std::move(copy));
+            assert( copy.empty() && moved.size() == 1000 );
+            moved.remove_if([](int) { return true; });
+            assert( moved.empty() );
+            moved = std::move(other);
+            assert( moved == ( counted{ 1, 50, 100, 30 } ) );
+        }
+        assert( alloc_counter::bytes == 0 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": stats policy.\n";
+
+        // By default nothing is recorded, and the iterators are still a bare pointer.
+        static_assert( std::is_empty<sc::no_stats>::value, "no_stats must take no space" );
+        static_assert( sizeof(sc::list<int>::iterator) == sizeof(void *), "iterator must not grow" );
+
+        using tracked = sc::list<int, std::allocator<int>, sc::list_stats>;
+        tracked seq{ 1, 2, 3, 4, 5 };
+        seq.push_back(6);
+        assert( seq.stats().allocations == 2 );
+        assert( seq.stats().peak_size == 6 );
+
+        auto it = seq.begin() + 4;
+        assert( *it == 5 );
+        assert( seq.end() - seq.begin() == 6 );
+
+        const sc::list_stats::histogram &advance = seq.stats().hops(sc::list_op::advance);
+        assert( advance.calls == 1 && advance.hops == 4 && advance.max_hops == 4 );
+        assert( advance.bucket[3] == 1 ); // [4, 8)
+        assert( seq.stats().hops(sc::list_op::distance).bucket[3] == 1 );
+
+        seq.erase( seq.begin(), it );
+        seq.pop_back();
+        assert( seq == ( tracked{ 5 } ) );
+        assert( seq.stats().frees == 1 );
+        assert( seq.stats().hops(sc::list_op::erase).calls == 2 );
+        assert( seq.stats().hops(sc::list_op::erase).hops == 4 );
+        assert( seq.stats().hops(sc::list_op::insert).calls == 1 );
+        assert( seq.stats().peak_size == 6 );
+
+        // The block of the initializer list goes back once its last node is gone.
+        seq.clear();
+        assert( seq.stats().allocations == seq.stats().frees );
+
+        std::ostringstream report;
+        report << seq.stats();
+        assert( report.str().find("advance: 1 calls, 4 hops, max 4") != std::string::npos );
+
+        seq.stats().reset();
+        assert( seq.stats().allocations == 0 && seq.stats().hops(sc::list_op::advance).calls == 0 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": compact() and locality().\n";
+
+        using tracked = sc::list<int, std::allocator<int>, sc::list_stats>;
+        tracked seq(4000);
+        std::vector<int> model(4000, 0);
+        assert( seq.locality() == 1.0 );
+
+        // Churn: every node that is inserted is allocated on its own, somewhere on the heap.
+        for (int step = 0; step < 20000; step++)
+        {
+            size_type at = std::rand() % (model.size() + 1);
+            if (std::rand() % 2 == 0 || model.empty())
+            {
+                seq.insert(seq.begin() + at, step);
+                model.insert(model.begin() + at, step);
+            }
+            else if (at < model.size())
+            {
+                seq.erase(seq.begin() + at);
+                model.erase(model.begin() + at);
+            }
+        }
+        assert( seq.locality() < 0.9 );
+
+        tracked copy(seq);
+        seq.compact();
+        assert( seq.locality() == 1.0 && seq == copy );
+        assert( std::vector<int>(seq.begin(), seq.end()) == model );
+
+        // A list that is already compact is left alone.
+        size_type allocations = seq.stats().allocations;
+        seq.compact();
+        assert( seq.stats().allocations == allocations );
+
+        // In steps, with the list changing between them.
+        for (int step = 0; step < 2000; step++)
+        {
+            size_type at = std::rand() % model.size();
+            copy.insert(copy.begin() + at, -step);
+            model.insert(model.begin() + at, -step);
+        }
+        tracked other;
+        int steps = 0;
+        while (!copy.compact(500))
+        {
+            steps++;
+            // Erase the front, and splice a node away, which may be where the next step resumes.
+            copy.pop_front();
+            model.erase(model.begin());
+            other.splice(other.end(), copy, copy.begin() + (steps * 37) % copy.size());
+            model.erase(model.begin() + (steps * 37) % model.size());
+        }
+        assert( steps > 1 && copy.locality() > 0.95 );
+        assert( std::vector<int>(copy.begin(), copy.end()) == model );
+
+        seq.clear();
+        copy.clear();
+        other.clear();
+        assert( seq.stats().allocations == seq.stats().frees );
+        assert( copy.stats().allocations + other.stats().allocations == copy.stats().frees + other.stats().frees );
+
+        // Elements that may throw when moved are copied, and a throw leaves the list as it was.
+        sc::list<Fragile> fragile;
+        for (int i = 0; i < 5; i++)
+            fragile.emplace_front(i);
+        bool thrown = false;
+        try
+        {
+            fragile.compact();
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert( thrown && fragile.size() == 5 );
+        int expected = 4;
+        for (const Fragile &f : fragile)
+            assert( f.v == expected-- );
+
+        // The step before the throwing element still succeeds.
+        assert( !fragile.compact(1) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": node reuse in assign() and operator=, reserve() and shrink_to_fit().\n";
+
+        using tracked = sc::list<int, std::allocator<int>, sc::list_stats>;
+        tracked seq{ 1, 2, 3, 4, 5 };
+        assert( seq.stats().allocations == 1 && seq.capacity() == 5 );
+
+        // Shorter contents overwrite the first nodes and free the others.
+        seq = { 7, 8, 9 };
+        assert( seq == ( tracked{ 7, 8, 9 } ) && seq.stats().allocations == 1 );
+
+        // Longer ones allocate only the difference, as one block.
+        seq.assign(6, 1);
+        assert( seq == ( tracked{ 1, 1, 1, 1, 1, 1 } ) && seq.stats().allocations == 2 );
+
+        tracked other{ 4, 3, 2, 1 };
+        seq = other;
+        assert( seq == other && seq.stats().allocations == 2 );
+        tracked big;
+        big.assign(10, 5);
+        seq = std::move(big);
+        assert( seq.size() == 10 && seq.capacity() == 10 );
+
+        // Refilling a reserved list every tick does not call the allocator.
+        seq.clear();
+        assert( seq.capacity() == 0 );
+        seq.reserve(100);
+        assert( seq.capacity() == 100 );
+        size_type allocations = seq.stats().allocations;
+        for (int tick = 0; tick < 10; tick++)
+        {
+            seq.clear();
+            for (int i = 0; i < 100; i++)
+                seq.push_back(tick);
+            seq.erase(seq.begin() + 10, seq.begin() + 20);
+            seq.insert(seq.begin(), { 1, 2, 3 });
+            seq.assign(100, tick);
+        }
+        assert( seq.stats().allocations == allocations );
+        assert( seq.size() == 100 && seq.capacity() == 100 && seq.count(9) == 100 );
+
+        seq.shrink_to_fit();
+        assert( seq.capacity() == 100 );
+        seq.clear();
+        seq.shrink_to_fit();
+        assert( seq.capacity() == 0 );
+
+        // Spare nodes of a block whose other nodes went to another list.
+        using counted = sc::list<int, counting_allocator<int>>;
+        {
+            counted a(10);
+            counted b;
+            a.reserve(10);
+            b.splice(b.end(), a, a.begin(), a.begin() + 5);
+            a.clear();
+            assert( a.capacity() == 5 );
+            b.clear();
+            a.assign(8, 3);
+            assert( a.size() == 8 && a.capacity() == 8 );
+
+            // A move takes the spare nodes along, and the moved-to list gives its own back.
+            a.pop_back();
+            counted c{ 1, 2 };
+            c.reserve(4);
+            c = std::move(a);
+            assert( c.size() == 7 && c.capacity() == 8 && a.capacity() == 0 );
+            counted d(std::move(c));
+            assert( d.capacity() == 8 && c.capacity() == 0 );
+            d.clear();
+            counted e(std::move(d));
+            assert( e.empty() && e.capacity() == 8 );
+        }
+        assert( alloc_counter::bytes == 0 );
+
+        // A spare node goes back to the spare nodes if constructing the element throws.
+        sc::list<Fragile> fragile;
+        fragile.reserve(2);
+        bool thrown = false;
+        try
+        {
+            Fragile three(3);
+            fragile.push_back(three);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert( thrown && fragile.empty() && fragile.capacity() == 2 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
     return 0;
 }
@@ -0,0 +1,148 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/lru_cache.hpp"
+
+// Weight of an entry as the bytes of its strings.
+struct string_bytes
+{
+    size_type operator()(const std::string &k, const std::string &v) const { return k.size() + v.size(); }
+};
+
+// The LRU cache driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": recency order and eviction callback.\n";
+
+        std::vector<int> evicted;
+        sc::lru_cache<int, std::string> cache(3, 1, sc::unit_weight(), [&evicted](const int &k, std::string &&v) {
+            assert( v == std::to_string(k) );
+            evicted.push_back(k);
+        });
+        assert( cache.shards() == 1 && cache.capacity() == 3 );
+
+        for (int k = 1; k <= 3; k++)
+            cache.put(k, std::to_string(k));
+
+        std::string out;
+        assert( cache.get(1, out) && out == "1" );
+        assert( !cache.get(9, out) );
+
+        // 2 is now the least recently used.
+        cache.put(4, "4");
+        assert( evicted == ( std::vector<int>{ 2 } ) );
+        assert( !cache.contains(2) && cache.contains(1) && cache.size() == 3 );
+
+        // Replacing a value makes it the most recent too.
+        cache.put(3, "3");
+        cache.put(5, "5");
+        cache.put(6, "6");
+        assert( evicted == ( std::vector<int>{ 2, 1, 4 } ) );
+        assert( cache.contains(3) && cache.contains(5) && cache.contains(6) );
+
+        sc::lru_counters c = cache.counters();
+        assert( c.hits == 1 && c.misses == 1 && c.evictions == 3 );
+
+        assert( cache.erase(5) && !cache.erase(5) );
+        cache.clear();
+        assert( cache.size() == 0 && cache.weight() == 0 );
+        assert( evicted.size() == 3 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": capacity in bytes.\n";
+
+        sc::lru_cache<std::string, std::string, std::hash<std::string>, string_bytes> cache(100, 1);
+        cache.put("a", std::string(39, 'x')); // 40 bytes
+        cache.put("b", std::string(39, 'x')); // 80 bytes
+        assert( cache.weight() == 80 );
+
+        cache.put("a", std::string(9, 'x')); // 50 bytes
+        assert( cache.weight() == 50 && cache.size() == 2 );
+
+        cache.put("c", std::string(59, 'x')); // 110 bytes: b goes
+        assert( cache.weight() == 70 && !cache.contains("b") );
+
+        // An entry heavier than the whole cache does not stay.
+        cache.put("d", std::string(200, 'x'));
+        assert( cache.size() == 0 && cache.weight() == 0 );
+        assert( cache.counters().evictions == 4 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": shards.\n";
+
+        sc::lru_cache<int, int> cache(1000, 8);
+        assert( cache.shards() == 8 && cache.capacity() == 1000 );
+
+        for (int k = 0; k < 5000; k++)
+            cache.put(k, k);
+        assert( cache.size() <= 1000 && cache.size() > 900 );
+        assert( cache.counters().evictions == 5000 - cache.size() );
+
+        // More shards than entries would leave shards that hold nothing.
+        sc::lru_cache<int, int> tiny(3, 64);
+        assert( tiny.shards() == 2 && tiny.capacity() == 3 );
+        sc::lru_cache<int, int> automatic(1 << 20);
+        assert( automatic.shards() >= 4 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": concurrent use.\n";
+
+        std::atomic<size_type> callbacks{0};
+        sc::lru_cache<int, int> *shared = nullptr;
+        sc::lru_cache<int, int> cache(512, 16, sc::unit_weight(), [&](const int &k, int &&v) {
+            assert( k == v );
+            // The callback runs without the lock and may use the cache.
+            shared->contains(k);
+            callbacks++;
+        });
+        shared = &cache;
+
+        const int threads = 4;
+        const int ops = 20000;
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++)
+        {
+            pool.emplace_back([&cache, t] {
+                unsigned seed = 12345u + t;
+                for (int i = 0; i < ops; i++)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    int key = (seed >> 8) % 2048;
+                    int value;
+
+                    if (cache.get(key, value))
+                        assert( value == key );
+                    else
+                        cache.put(key, key);
+                }
+            });
+        }
+        for (auto &th : pool)
+            th.join();
+
+        sc::lru_counters c = cache.counters();
+        assert( c.hits + c.misses == size_type(threads) * ops );
+        assert( c.evictions == callbacks );
+        assert( cache.size() <= 512 && cache.weight() == cache.size() );
+        assert( c.evictions <= c.misses );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../include/parallel_algorithm.hpp"
+
+// The parallel algorithms driver.
+int main(void)
+{
+    auto n_unit{0};
+    sc::thread_pool pool(4);
+    const int n = 100000;
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": thread_pool::run().\n";
+        std::vector<std::atomic<int>> hits(1000);
+        pool.run(hits.size(), [&](std::size_t i) { hits[i]++; });
+        for (auto &h : hits)
+            assert(h == 1);
+
+        pool.run(0, [](std::size_t) { assert(false); });
+
+        bool thrown = false;
+        try
+        {
+            pool.run(10, [](std::size_t i) { if (i == 3) throw std::runtime_error("task"); });
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": segments.\n";
+        for (auto len : {0, 1, 4095, 4096, 100000, 5000000})
+        {
+            size_type count = sc::parallel::segment_count(len);
+            size_type total = 0;
+            for (size_type i = 0; i < count; i++)
+                total += sc::parallel::segment_length(len, count, i);
+            assert(total == size_type(len));
+            assert(count <= sc::parallel::max_segments);
+        }
+
+        sc::list<int> seq;
+        for (auto i{0}; i < 10000; ++i)
+            seq.push_back(i);
+        auto points = sc::parallel::split(seq.cbegin(), seq.size(), 3);
+        assert(points.size() == 3);
+        assert(*points[0] == 0 && *points[1] == 3334 && *points[2] == 6667);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": parallel_for_each() and parallel_transform().\n";
+        sc::list<int> seq;
+        for (auto i{0}; i < n; ++i)
+            seq.push_back(i);
+
+        std::atomic<long long> sum{0};
+        sc::parallel_for_each(seq, [&](int e) { sum += e; }, pool);
+        assert(sum == (long long)n * (n - 1) / 2);
+
+        sc::parallel_transform(seq, [](int e) { return 2 * e + 1; }, pool);
+        auto i{0};
+        for (auto e : seq)
+            assert(e == 2 * i++ + 1);
+
+        sc::list<int> empty;
+        sc::parallel_transform(empty, [](int) { assert(false); return 0; }, pool);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": parallel_reduce() and parallel_count_if().\n";
+        sc::list<long long> nums;
+        for (auto i{0}; i < n; ++i)
+            nums.push_back(i);
+
+        assert(sc::parallel_reduce(nums, pool) == (long long)n * (n - 1) / 2);
+        assert(sc::parallel_reduce(nums, 10LL, std::plus<>(), pool) == (long long)n * (n - 1) / 2 + 10);
+        assert(sc::parallel_count_if(nums, [](long long e) { return e % 3 == 0; }, pool) == size_type((n + 2) / 3));
+        assert(sc::parallel_reduce(sc::list<int>{}, 7, std::plus<>(), pool) == 7);
+
+        // Associative but not commutative: the segments must be combined in order.
+        sc::list<std::string> words;
+        std::string expected;
+        for (auto k{0}; k < n; ++k)
+        {
+            words.push_back(std::string(1, char('a' + k % 26)));
+            expected += words.back();
+        }
+        auto joined = sc::parallel_reduce(words, std::string(">"), std::plus<>(), pool);
+        assert(joined == ">" + expected);
+
+        // Same result on the shared pool.
+        assert(sc::parallel_reduce(words, std::string(">"), std::plus<>()) == joined);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdint>
+#include <cstdio>   // remove()
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include "../include/persistent_list.hpp"
+
+// Returns true if the list holds the same elements as the model, in both directions.
+template <typename List, typename Model>
+bool same(const List &seq, const Model &model)
+{
+    if (seq.size() != model.size())
+        return false;
+
+    auto m = model.begin();
+    for (auto it = seq.begin(); it != seq.end(); ++it, ++m)
+    {
+        if (*it != *m)
+            return false;
+    }
+
+    auto r = model.end();
+    for (auto it = seq.end(); it != seq.begin();)
+    {
+        if (*--it != *--r)
+            return false;
+    }
+
+    return true;
+}
+
+// Copies the file as it is now, as if the process had stopped at this point.
+void snapshot(const std::string &from, const std::string &to)
+{
+    std::ifstream in(from, std::ios::binary);
+    std::ofstream out(to, std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+}
+
+long file_length(const std::string &path)
+{
+    struct stat st;
+    stat(path.c_str(), &st);
+    return static_cast<long>(st.st_size);
+}
+
+struct sample
+{
+    std::int64_t id;
+    double value;
+
+    bool operator!=(const sample &rhs) const { return id != rhs.id || value != rhs.value; }
+};
+
+// The persistent list driver.
+int main(void)
+{
+    auto n_unit{0};
+    const std::string path = "persistent_list_test.dat";
+    const std::string crashed = "persistent_list_crashed.dat";
+    std::remove(path.c_str());
+    std::remove(crashed.c_str());
+
+    std::list<int> model;
+    std::list<int> saved; // Contents of the file at path
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": operations and growth of the file.\n";
+
+        sc::persistent_list<int> seq(path);
+        assert( seq.empty() && !seq.recovered() );
+
+        seq.push_back(1);
+        auto first = seq.begin();
+        for (int i = 2; i <= 20000; i++)
+            seq.push_back(i);
+        for (int i = 1; i <= 20000; i++)
+            model.push_back(i);
+
+        // Iterators survive the file being mapped again.
+        assert( *first == 1 && file_length(path) > 64 * 1024 );
+        assert( same(seq, model) );
+
+        seq.push_front(0);
+        model.push_front(0);
+        seq.push_back(seq.front());
+        model.push_back(0);
+        seq.pop_front();
+        model.pop_front();
+        seq.pop_back();
+        model.pop_back();
+
+        auto it = seq.insert(seq.begin() + 5, -5);
+        model.insert(std::next(model.begin(), 5), -5);
+        assert( *it == -5 && same(seq, model) );
+
+        it = seq.erase(seq.begin() + 100, seq.begin() + 200);
+        model.erase(std::next(model.begin(), 100), std::next(model.begin(), 200));
+        assert( *it == *std::next(model.begin(), 100) && same(seq, model) );
+
+        *seq.begin() = 42;
+        model.front() = 42;
+        assert( same(seq, model) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": reopening the file.\n";
+
+        sc::persistent_list<int> seq(path);
+        assert( !seq.recovered() );
+        assert( same(seq, model) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": erased nodes are reused.\n";
+
+        sc::persistent_list<int> seq(path);
+        long length = file_length(path);
+        size_type capacity = seq.capacity();
+
+        for (int i = 0; i < 10000; i++)
+        {
+            seq.pop_back();
+            model.pop_back();
+        }
+        assert( seq.capacity() == capacity );
+
+        for (int i = 0; i < 10000; i++)
+        {
+            seq.push_front(i);
+            model.push_front(i);
+        }
+        assert( file_length(path) == length && seq.capacity() == capacity );
+        assert( same(seq, model) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": recovery after a crash.\n";
+
+        {
+            sc::persistent_list<int> seq(path, sc::durability::ordered);
+            for (int i = 0; i < 50; i++)
+            {
+                seq.erase(seq.begin() + i);
+                model.erase(std::next(model.begin(), i));
+                seq.insert(seq.begin() + 2 * i, i);
+                model.insert(std::next(model.begin(), 2 * i), i);
+            }
+
+            // The process stops here: the list is never closed.
+            snapshot(path, crashed);
+        }
+        saved = model;
+
+        {
+            // What only recovery relies on is correct: break the size and a prev link.
+            std::fstream file(crashed, std::ios::binary | std::ios::in | std::ios::out);
+            const std::uint64_t wrong_size = 7;
+            file.seekp(32);
+            file.write(reinterpret_cast<const char *>(&wrong_size), sizeof(wrong_size));
+            file.seekp(48); // sentinel.prev
+            file.write(reinterpret_cast<const char *>(&wrong_size), sizeof(wrong_size));
+        }
+
+        sc::persistent_list<int> seq(crashed);
+        assert( seq.recovered() );
+        assert( same(seq, model) );
+
+        // The recovered free list holds the nodes the list does not reach.
+        size_type capacity = seq.capacity();
+        for (int i = 0; i < 100; i++)
+        {
+            seq.push_back(i);
+            model.push_back(i);
+        }
+        assert( seq.capacity() == capacity && same(seq, model) );
+
+        seq.clear();
+        assert( seq.empty() && seq.begin() == seq.end() );
+        seq.push_back(3);
+        assert( seq.front() == 3 && seq.back() == 3 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": files that do not hold a list of T.\n";
+
+        bool thrown = false;
+        try
+        {
+            sc::persistent_list<double> wrong(path);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert( thrown );
+
+        std::ofstream("persistent_list_text.dat") << std::string(200, 'x');
+        thrown = false;
+        try
+        {
+            sc::persistent_list<int> wrong("persistent_list_text.dat");
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        assert( thrown );
+        std::remove("persistent_list_text.dat");
+
+        // The original file is untouched.
+        sc::persistent_list<int> seq(path);
+        assert( !seq.recovered() && same(seq, saved) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": elements of a struct type.\n";
+
+        std::remove(path.c_str());
+        {
+            sc::persistent_list<sample> seq(path, sc::durability::ordered);
+            for (int i = 0; i < 1000; i++)
+                seq.push_back({i, i * 0.5});
+        }
+
+        sc::persistent_list<sample> seq(path);
+        assert( seq.size() == 1000 && !seq.recovered() );
+        assert( seq.back().id == 999 && seq.back().value == 499.5 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    std::remove(path.c_str());
+    std::remove(crashed.c_str());
+    return 0;
+}
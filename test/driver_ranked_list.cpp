@@ -0,0 +1,168 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdlib>  // rand()
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../include/ranked_list.hpp"
+
+// Checks the list against a vector with the same contents, using both the links and the index.
+template <typename T>
+void check(const sc::ranked_list<T> &seq, const std::vector<T> &model)
+{
+    assert(seq.size() == model.size());
+
+    size_type i = 0;
+    for (auto it = seq.begin(); it != seq.end(); ++it, ++i)
+    {
+        assert(*it == model[i]);
+        assert(seq.index_of(it) == i);
+        assert(seq.nth(i) == it);
+    }
+    assert(seq.nth(seq.size()) == seq.end());
+    assert(seq.index_of(seq.end()) == seq.size());
+
+    i = model.size();
+    for (auto it = seq.end(); it != seq.begin();)
+        assert(*--it == model[--i]);
+}
+
+// The ranked list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": constructors and assignment.\n";
+        sc::ranked_list<int> seq{1, 2, 3, 4, 5};
+        check(seq, {1, 2, 3, 4, 5});
+
+        sc::ranked_list<int> copy(seq);
+        assert(copy == seq);
+
+        // Moving relinks the nodes and the sentinel links, so it cannot throw.
+        static_assert(std::is_nothrow_move_constructible_v<sc::ranked_list<int>>, "move constructor must be noexcept");
+        static_assert(std::is_nothrow_move_assignable_v<sc::ranked_list<int>>, "move assignment must be noexcept");
+        sc::ranked_list<int> moved(std::move(copy));
+        assert(copy.empty() && moved == seq);
+        check(moved, {1, 2, 3, 4, 5});
+
+        copy = moved;
+        moved = {7, 8};
+        check(moved, {7, 8});
+        moved = std::move(copy);
+        check(moved, {1, 2, 3, 4, 5});
+        assert(moved != sc::ranked_list<int>(3));
+
+        sc::ranked_list<std::string> words(3);
+        assert(words.size() == 3 && words[2].empty());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push, pop and positional access.\n";
+        sc::ranked_list<int> seq;
+        std::vector<int> model;
+
+        for (auto i{0}; i < 2000; ++i)
+        {
+            seq.push_back(i);
+            model.push_back(i);
+            seq.push_front(-i);
+            model.insert(model.begin(), -i);
+        }
+        check(seq, model);
+
+        for (auto i{0}; i < 700; ++i)
+        {
+            seq.pop_back();
+            model.pop_back();
+            seq.pop_front();
+            model.erase(model.begin());
+        }
+        check(seq, model);
+        assert(seq.front() == model.front() && seq.back() == model.back());
+
+        for (size_type k = 0; k < model.size(); k += 97)
+        {
+            assert(seq[k] == model[k]);
+            assert(*(seq.begin() + int(k)) == model[k]);
+            assert(seq.nth(k) - seq.begin() == k);
+            assert(seq.end() - seq.nth(k) == model.size() - k);
+        }
+
+        auto it = seq.begin();
+        seq.advance(it, 1000);
+        assert(*it == model[1000]);
+        seq.advance(it, -600);
+        assert(*it == model[400]);
+        assert(seq.distance(it, seq.begin()) == -400);
+        assert(seq.distance(seq.cbegin(), seq.cend()) == std::ptrdiff_t(model.size()));
+
+        sc::ranked_list<int>::const_iterator cit = seq.cbegin();
+        seq.advance(cit, 3);
+        assert(*cit == model[3] && *(cit + 2) == model[5]);
+
+        // operator+ stops at the end mark and ignores negative steps, like sc::list.
+        assert(seq.begin() + (-1) == seq.begin() && cit + (-5) == cit);
+        assert(seq.begin() + int(model.size() + 10) == seq.end());
+        assert(seq.end() + 3 == seq.end() && seq.nth(model.size() - 2) + 100 == seq.end());
+
+        // The sentinel drops the levels of a cleared list, so a walk from it never follows them.
+        seq.clear();
+        seq.push_back(1);
+        assert(seq.end() + 1000 == seq.end() && seq.begin() + 1 == seq.end());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": random insert() and erase() at iterators.\n";
+        sc::ranked_list<int> seq;
+        std::vector<int> model;
+        std::srand(11);
+
+        for (auto i{0}; i < 20000; ++i)
+        {
+            size_type pos = model.empty() ? 0 : std::rand() % (model.size() + 1);
+
+            if (model.empty() || std::rand() % 5 < 3)
+            {
+                auto it = seq.insert(seq.nth(pos), i);
+                model.insert(model.begin() + pos, i);
+                assert(*it == i && seq.index_of(it) == pos);
+            }
+            else
+            {
+                pos = std::min<size_type>(pos, model.size() - 1);
+                auto it = seq.erase(seq.nth(pos));
+                model.erase(model.begin() + pos);
+                assert(seq.index_of(it) == pos);
+            }
+
+            if (i % 2000 == 0)
+                check(seq, model);
+        }
+        check(seq, model);
+
+        auto first = seq.insert(seq.nth(10), {-1, -2, -3});
+        model.insert(model.begin() + 10, {-1, -2, -3});
+        assert(seq.index_of(first) == 10);
+        check(seq, model);
+
+        auto after = seq.erase(seq.nth(5), seq.nth(500));
+        model.erase(model.begin() + 5, model.begin() + 500);
+        assert(seq.index_of(after) == 5);
+        check(seq, model);
+
+        seq.clear();
+        assert(seq.empty() && seq.begin() == seq.end());
+        seq.push_back(1);
+        check(seq, {1});
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
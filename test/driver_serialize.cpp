@@ -0,0 +1,206 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/serialize.hpp"
+
+// Trivially copyable, but not default-constructible.
+struct point
+{
+    int x, y;
+
+    point(int x, int y) : x{x}, y{y} {}
+
+    bool operator==(const point &rhs) const { return x == rhs.x && y == rhs.y; }
+    bool operator!=(const point &rhs) const { return !(*this == rhs); }
+};
+
+// Needs the customization point.
+struct record
+{
+    std::string name;
+    std::vector<int> scores;
+
+    bool operator==(const record &rhs) const { return name == rhs.name && scores == rhs.scores; }
+    bool operator!=(const record &rhs) const { return !(*this == rhs); }
+};
+
+namespace sc
+{
+    template <>
+    struct serializer<record>
+    {
+        static void save(byte_writer &out, const record &r)
+        {
+            serializer<std::string>::save(out, r.name);
+            out.put(static_cast<std::uint32_t>(r.scores.size()));
+            out.write(r.scores.data(), r.scores.size() * sizeof(int));
+        }
+
+        static record load(byte_reader &in)
+        {
+            record r;
+            r.name = serializer<std::string>::load(in);
+            r.scores.resize(in.get<std::uint32_t>());
+            in.read(r.scores.data(), r.scores.size() * sizeof(int));
+            return r;
+        }
+    };
+} // namespace sc
+
+// Saves seq and loads it back into a new list.
+template <typename List>
+List round_trip(const List &seq)
+{
+    std::stringstream buffer;
+    sc::save(buffer, seq);
+
+    List copy;
+    sc::load(buffer, copy);
+    assert( buffer.peek() == std::char_traits<char>::eof() );
+    return copy;
+}
+
+// Returns true if loading the bytes throws sc::serialization_error and leaves seq as it was.
+template <typename List>
+bool rejects(const std::string &bytes, List &seq)
+{
+    List before(seq);
+    std::istringstream in(bytes);
+
+    try
+    {
+        sc::load(in, seq);
+    }
+    catch (const sc::serialization_error &)
+    {
+        return seq == before;
+    }
+
+    return false;
+}
+
+// The serialization driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": raw elements.\n";
+
+        sc::list<int> seq;
+        for (int i = 0; i < 50000; i++)
+            seq.push_back(i * 7);
+
+        std::stringstream buffer;
+        sc::save(buffer, seq);
+
+        // Header, four frames of at most 64 KiB each and the end mark.
+        const std::size_t frames = (50000 * sizeof(int) + 64 * 1024 - 1) / (64 * 1024);
+        assert( buffer.str().size() == 24 + frames * 16 + 50000 * sizeof(int) + 16 );
+
+        sc::list<int> copy{ 1, 2, 3 };
+        sc::load(buffer, copy);
+        assert( copy == seq );
+
+        sc::list<int> empty;
+        assert( round_trip(seq).size() == 50000 );
+        std::stringstream none;
+        sc::save(none, empty);
+        sc::load(none, copy);
+        assert( copy.empty() );
+
+        sc::list<point> points{ {1, 2}, {3, 4}, {5, 6} };
+        assert( round_trip(points) == points );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": elements through sc::serializer.\n";
+
+        sc::list<std::string> words{ "", "linked", std::string(100000, 'x'), "list" };
+        for (int i = 0; i < 10000; i++)
+            words.push_back(std::to_string(i));
+        assert( round_trip(words) == words );
+
+        sc::list<record> records{ {"ana", {1, 2, 3}}, {"bia", {}}, {"caio", std::vector<int>(20000, 9)} };
+        assert( round_trip(records) == records );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": several lists in one stream.\n";
+
+        sc::list<int> a{ 1, 2, 3 };
+        sc::list<std::string> b{ "one", "two" };
+        sc::list<double> c{ 0.5 };
+
+        std::stringstream buffer;
+        sc::save(buffer, a);
+        sc::save(buffer, b);
+        sc::save(buffer, c);
+
+        sc::list<int> ra;
+        sc::list<std::string> rb;
+        sc::list<double> rc;
+        sc::load(buffer, ra);
+        sc::load(buffer, rb);
+        sc::load(buffer, rc);
+        assert( ra == a && rb == b && rc == c );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": malformed streams.\n";
+
+        sc::list<int> ints{ 4, 5, 6 };
+        std::stringstream buffer;
+        sc::save(buffer, sc::list<int>{ 1, 2, 3, 4 });
+        const std::string good = buffer.str();
+
+        assert( rejects(good.substr(0, good.size() - 1), ints) );
+        assert( rejects(good.substr(0, 10), ints) );
+        assert( rejects("not a list at all, not at all", ints) );
+
+        std::string newer = good;
+        newer[4] = 9;
+        assert( rejects(newer, ints) );
+
+        std::string longer = good;
+        longer[16] = 3; // The header announces fewer elements than the frames hold.
+        assert( rejects(longer, ints) );
+
+        // The element type must match.
+        sc::list<double> doubles{ 1.5 };
+        sc::list<std::string> strings{ "kept" };
+        assert( rejects(good, doubles) );
+        assert( rejects(good, strings) );
+
+        std::stringstream text;
+        sc::save(text, strings);
+        assert( rejects(text.str(), ints) );
+
+        // A corrupt frame length is reported, not allocated.
+        std::string huge = text.str();
+        for (std::size_t i = 32; i < 40; i++)
+            huge[i] = '\x7f';
+        assert( rejects(huge, strings) );
+        for (std::size_t i = 32; i < 40; i++)
+            huge[i] = '\xff';
+        assert( rejects(huge, strings) );
+
+        sc::list<int> loaded;
+        std::istringstream in(good);
+        sc::load(in, loaded);
+        assert( loaded == ( sc::list<int>{ 1, 2, 3, 4 } ) );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}
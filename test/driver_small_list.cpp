@@ -0,0 +1,213 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdlib>  // rand()
+#include <list>     // std::list as a reference
+#include <memory>   // unique_ptr
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../include/small_list.hpp"
+
+/// Counts the nodes obtained from every tracking_allocator.
+struct heap_counter
+{
+    static inline long allocations = 0;
+    static inline long live = 0;
+};
+
+/// Allocator that records its activity in heap_counter. Allocators with different ids are not equal.
+template <typename T>
+struct tracking_allocator
+{
+    using value_type = T;
+    int id = 0;
+
+    tracking_allocator(int i = 0) : id{i} {}
+    template <typename U>
+    tracking_allocator(const tracking_allocator<U> &o) : id{o.id} {}
+
+    T *allocate(std::size_t n)
+    {
+        heap_counter::allocations++;
+        heap_counter::live++;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        heap_counter::live--;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const tracking_allocator<U> &o) const { return id == o.id; }
+    template <typename U>
+    bool operator!=(const tracking_allocator<U> &o) const { return id != o.id; }
+};
+
+template <typename L, typename R>
+bool same(const L &lhs, const R &rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    auto r = rhs.begin();
+    for (auto l = lhs.begin(); l != lhs.end(); ++l, ++r)
+        if (!(*l == *r))
+            return false;
+
+    return true;
+}
+
+// The small list driver.
+int main(void)
+{
+    auto n_unit{0};
+    using small = sc::small_list<int, 4, tracking_allocator<int>>;
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": short lists do not allocate.\n";
+
+        small seq{ 1, 2, 3 };
+        seq.push_front(0);
+        assert( heap_counter::allocations == 0 );
+        assert( same(seq, std::vector<int>{ 0, 1, 2, 3 }) );
+
+        // Nodes freed by erasures are taken again.
+        for (int i = 0; i < 100; i++)
+        {
+            seq.pop_front();
+            seq.push_back(i);
+        }
+        seq.erase(seq.begin() + 1, seq.begin() + 3);
+        seq.insert(seq.begin() + 1, { 7, 8 });
+        assert( heap_counter::allocations == 0 );
+        assert( same(seq, std::vector<int>{ 96, 7, 8, 99 }) );
+
+        // Heap nodes are relinked and inline elements moved, so moves throw only if T's move does.
+        static_assert( std::is_nothrow_move_constructible_v<sc::small_list<std::string, 2>>, "move constructor must be noexcept" );
+        static_assert( std::is_nothrow_move_assignable_v<sc::small_list<std::string, 2>>, "move assignment must be noexcept" );
+        struct Throwing
+        {
+            Throwing() = default;
+            Throwing(Throwing &&) noexcept(false) {}
+        };
+        static_assert( !std::is_nothrow_move_constructible_v<sc::small_list<Throwing, 2>>, "inline elements are moved" );
+
+        small copy(seq);
+        small moved(std::move(copy));
+        assert( copy.empty() && moved == seq );
+        assert( heap_counter::allocations == 0 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": spilling past N and iterator stability against std::list.\n";
+
+        small seq;
+        std::list<int> model;
+        std::vector<small::iterator> its;
+        std::vector<std::list<int>::iterator> model_its;
+
+        for (int step = 0; step < 5000; step++)
+        {
+            int op = std::rand() % 3;
+            if (op < 2 || model.empty())
+            {
+                size_type at = std::rand() % (model.size() + 1);
+                auto pos = seq.begin() + at;
+                auto mpos = std::next(model.begin(), at);
+                its.push_back(seq.insert(pos, step));
+                model_its.push_back(model.insert(mpos, step));
+            }
+            else
+            {
+                size_type k = std::rand() % its.size();
+                seq.erase(its[k]);
+                model.erase(model_its[k]);
+                its.erase(its.begin() + k);
+                model_its.erase(model_its.begin() + k);
+            }
+
+            // Keep the list short now and then, so inline nodes are reused.
+            if (step % 500 == 499)
+            {
+                while (its.size() > 2)
+                {
+                    seq.erase(its.back());
+                    model.erase(model_its.back());
+                    its.pop_back();
+                    model_its.pop_back();
+                }
+            }
+        }
+
+        assert( same(seq, model) );
+        // Every kept iterator still refers to its element, inline or not.
+        size_type inline_nodes = 0;
+        for (size_type k = 0; k < its.size(); k++)
+        {
+            assert( *its[k] == *model_its[k] );
+            inline_nodes += seq.is_inline(its[k]) ? 1 : 0;
+        }
+        assert( inline_nodes <= small::inline_capacity );
+        assert( heap_counter::live == long(seq.size() - inline_nodes) );
+
+        // A free inline node is taken before the allocator is called.
+        long allocations = heap_counter::allocations;
+        while (inline_nodes < small::inline_capacity)
+        {
+            seq.push_back(-1);
+            inline_nodes++;
+        }
+        assert( heap_counter::allocations == allocations );
+
+        seq.clear();
+        assert( heap_counter::live == 0 );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": moves with inline and heap nodes.\n";
+
+        sc::small_list<std::string, 2, tracking_allocator<std::string>> seq{ "a", "b", "c", "d" };
+        auto heap_it = seq.begin() + 3;
+        assert( !seq.is_inline(heap_it) && seq.is_inline(seq.begin()) );
+        long allocations = heap_counter::allocations;
+
+        // Heap nodes are relinked, so their iterators now refer to the new list; inline elements are moved.
+        auto moved(std::move(seq));
+        assert( seq.empty() && same(moved, std::vector<std::string>{ "a", "b", "c", "d" }) );
+        assert( heap_counter::allocations == allocations );
+        assert( *heap_it == "d" && ++heap_it == moved.end() );
+        assert( moved.is_inline(moved.begin()) && seq.begin() == seq.end() );
+
+        // The moved-from list is usable.
+        seq.push_back("e");
+        assert( seq.front() == "e" && seq.is_inline(seq.begin()) );
+
+        seq = std::move(moved);
+        assert( moved.empty() && same(seq, std::vector<std::string>{ "a", "b", "c", "d" }) );
+        assert( heap_counter::allocations == allocations );
+
+        // Allocators that differ and do not propagate: every element is moved.
+        sc::small_list<std::string, 2, tracking_allocator<std::string>> other(tracking_allocator<std::string>(1));
+        other = std::move(seq);
+        assert( seq.empty() && same(other, std::vector<std::string>{ "a", "b", "c", "d" }) );
+        assert( heap_counter::allocations == allocations + 2 );
+
+        // Move-only elements.
+        sc::small_list<std::unique_ptr<int>, 1> owners;
+        owners.push_back(std::make_unique<int>(1));
+        owners.push_back(std::make_unique<int>(2));
+        auto taken(std::move(owners));
+        assert( *taken.front() == 1 && *taken.back() == 2 && owners.empty() );
+
+        std::cout << ">>> Passed!\n\n";
+    }
+    assert( heap_counter::live == 0 );
+
+    return 0;
+}
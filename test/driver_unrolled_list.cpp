@@ -0,0 +1,240 @@
+#include <iostream> // cout, endl
+#include <cassert>  // assert()
+#include <cstdlib>  // rand()
+#include <list>     // std::list as a reference
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "../include/unrolled_list.hpp"
+
+template <typename L, typename R>
+bool same(const L &lhs, const R &rhs)
+{
+    if (lhs.size() != rhs.size())
+        return false;
+
+    auto r = rhs.begin();
+    for (auto l = lhs.begin(); l != lhs.end(); ++l, ++r)
+        if (!(*l == *r))
+            return false;
+
+    return true;
+}
+
+/// Element whose copy constructor throws when its text is "boom".
+struct Fragile
+{
+    std::string text;
+
+    Fragile(const char *t) : text{t} {}
+    Fragile(const Fragile &o) : text{o.text}
+    {
+        if (text == "boom")
+            throw std::runtime_error("copy failed");
+    }
+    Fragile(Fragile &&) = default;
+    Fragile &operator=(const Fragile &) = default;
+
+    bool operator==(const Fragile &o) const { return text == o.text; }
+    bool operator!=(const Fragile &o) const { return text != o.text; }
+};
+
+// The unrolled list driver.
+int main(void)
+{
+    auto n_unit{0};
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": constructors.\n";
+        sc::unrolled_list<int> seq;
+        assert(seq.empty());
+        assert(seq.begin() == seq.end());
+
+        sc::unrolled_list<int> seq2(100);
+        assert(seq2.size() == 100);
+        for (auto e : seq2)
+            assert(e == 0);
+
+        sc::unrolled_list<int> seq3{1, 2, 3, 4, 5};
+        auto i{0};
+        for (auto e : seq3)
+            assert(e == ++i);
+
+        sc::unrolled_list<int> seq4(seq3);
+        assert(seq4 == seq3);
+
+        // Moving hands over the chunks and cannot throw.
+        static_assert(std::is_nothrow_move_constructible_v<sc::unrolled_list<int>>, "move constructor must be noexcept");
+        static_assert(std::is_nothrow_move_assignable_v<sc::unrolled_list<int>>, "move assignment must be noexcept");
+        sc::unrolled_list<int> seq5(std::move(seq4));
+        assert(seq5 == seq3);
+        assert(seq4.empty());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": push/pop at both ends across chunks.\n";
+        const int n = 10 * sc::unrolled_list<int>::chunk_capacity + 3;
+        sc::unrolled_list<int> seq;
+
+        for (auto i{0}; i < n; ++i)
+            seq.push_back(i);
+        for (auto i{1}; i <= n; ++i)
+            seq.push_front(-i);
+
+        assert(seq.size() == size_type(2 * n));
+        assert(seq.front() == -n);
+        assert(seq.back() == n - 1);
+
+        auto i{-n};
+        for (auto e : seq)
+            assert(e == i++);
+
+        while (seq.size() > 1)
+        {
+            seq.pop_front();
+            seq.pop_back();
+        }
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": iterator arithmetic.\n";
+        sc::unrolled_list<int> seq;
+        for (auto i{0}; i < 1000; ++i)
+            seq.push_back(i);
+
+        assert(*(seq.begin() + 517) == 517);
+        assert(*(3 + seq.begin()) == 3);
+        assert(seq.begin() + 1000 == seq.end());
+        assert(seq.end() - seq.begin() == 1000);
+        assert((seq.begin() + 900) - (seq.begin() + 13) == 887);
+
+        auto it = seq.end();
+        --it;
+        assert(*it == 999);
+        it--;
+        assert(*it == 998);
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": insert/erase in the middle against std::list.\n";
+        sc::unrolled_list<std::string> seq;
+        std::list<std::string> ref;
+
+        std::srand(42);
+        for (auto round{0}; round < 20000; ++round)
+        {
+            size_type pos = ref.empty() ? 0 : std::rand() % (ref.size() + 1);
+            auto it = seq.begin() + static_cast<int>(pos);
+            auto rit = ref.begin();
+            std::advance(rit, pos);
+
+            if (std::rand() % 3 != 0 || pos == ref.size())
+            {
+                auto value = std::to_string(round);
+                auto ins = seq.insert(it, value);
+                ref.insert(rit, value);
+                assert(*ins == value);
+            }
+            else
+            {
+                auto nxt = seq.erase(it);
+                auto rnxt = ref.erase(rit);
+                assert(rnxt == ref.end() ? nxt == seq.end() : *nxt == *rnxt);
+            }
+        }
+        assert(same(seq, ref));
+
+        // Range versions.
+        auto first = seq.insert(seq.begin() + 10, {"a", "b", "c"});
+        assert(*first == "a");
+        auto rit = ref.begin();
+        std::advance(rit, 10);
+        ref.insert(rit, {"a", "b", "c"});
+        assert(same(seq, ref));
+
+        auto after = seq.erase(seq.begin() + 5, seq.begin() + 500);
+        auto rfirst = ref.begin(), rlast = ref.begin();
+        std::advance(rfirst, 5);
+        std::advance(rlast, 500);
+        assert(*after == *ref.erase(rfirst, rlast));
+        assert(same(seq, ref));
+
+        seq.erase(seq.begin(), seq.end());
+        assert(seq.empty());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": assignment and comparison.\n";
+        sc::unrolled_list<int> seq{1, 2, 3};
+        sc::unrolled_list<int> seq2;
+
+        seq2 = seq;
+        assert(seq2 == seq);
+        seq2 = {1, 2, 4};
+        assert(seq2 != seq);
+        seq = std::move(seq2);
+        assert(seq == (sc::unrolled_list<int>{1, 2, 4}));
+        assert(seq2.empty());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    {
+        std::cout << ">>> Unit teste #" << ++n_unit << ": an insertion that throws leaves the list unchanged.\n";
+        const Fragile boom("boom");
+
+        // The elements shifted up to open the hole are moved back.
+        sc::unrolled_list<Fragile> seq{"a", "b", "c"};
+        try
+        {
+            seq.insert(seq.begin() + 1, boom);
+            assert(false);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        assert(same(seq, std::list<Fragile>{"a", "b", "c"}));
+
+        // The chunk created for the element is unlinked and freed.
+        sc::unrolled_list<Fragile> empty;
+        try
+        {
+            empty.push_back(boom);
+            assert(false);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        assert(empty.empty() && empty.begin() == empty.end());
+
+        // Same with a full last chunk, which makes the list start a new one.
+        sc::unrolled_list<Fragile> full;
+        for (size_type i = 0; i < sc::unrolled_list<Fragile>::chunk_capacity; i++)
+            full.push_back("x");
+        try
+        {
+            full.push_back(boom);
+            assert(false);
+        }
+        catch (const std::runtime_error &)
+        {
+        }
+        assert(full.size() == sc::unrolled_list<Fragile>::chunk_capacity && full.back() == Fragile("x"));
+        size_type walked = 0;
+        for (auto it = full.begin(); it != full.end(); ++it)
+            walked++;
+        assert(walked == full.size());
+
+        std::cout << ">>> Passed!\n\n";
+    }
+
+    return 0;
+}